@@ -20,24 +20,24 @@ void EventsCodeGenerationContext::InheritsFrom(
   parent = &parent_;
 
   // Objects lists declared by parent became "already declared" in the child
-  // context.
-  alreadyDeclaredObjectsLists = parent_.alreadyDeclaredObjectsLists;
-  std::copy(parent_.objectsListsToBeDeclared.begin(),
-            parent_.objectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.objectsListsOrEmptyToBeDeclared.begin(),
-            parent_.objectsListsOrEmptyToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
-  std::copy(parent_.emptyObjectsListsToBeDeclared.begin(),
-            parent_.emptyObjectsListsToBeDeclared.end(),
-            std::inserter(alreadyDeclaredObjectsLists,
-                          alreadyDeclaredObjectsLists.begin()));
+  // context. Only the lists of the parent itself are copied: the ones of its
+  // own parents are shared.
+  if (parent_.depthOfLastUse.empty() &&
+      parent_.objectsListsToBeDeclared.empty() &&
+      parent_.objectsListsOrEmptyToBeDeclared.empty() &&
+      parent_.emptyObjectsListsToBeDeclared.empty()) {
+    parentObjectsLists = parent_.parentObjectsLists;
+  } else {
+    auto objectsLists = std::make_shared<ParentObjectsLists>();
+    objectsLists->parent = parent_.parentObjectsLists;
+    objectsLists->declaredObjectsLists = parent_.GetAllObjectsToBeDeclared();
+    objectsLists->depthOfLastUse = parent_.depthOfLastUse;
+    parentObjectsLists = objectsLists;
+  }
 
   nearestAsyncParent = parent_.IsAsyncCallback() ? &parent_ : parent_.nearestAsyncParent;
   asyncDepth = parent_.asyncDepth;
-  depthOfLastUse = parent_.depthOfLastUse;
+  depthOfLastUse.clear();
   customConditionDepth = parent_.customConditionDepth;
   contextDepth = parent_.GetContextDepth() + 1;
   if (parent_.maxDepthLevel) {
@@ -103,6 +103,31 @@ void EventsCodeGenerationContext::EmptyObjectsListNeeded(
   depthOfLastUse[objectName] = GetContextDepth();
 }
 
+bool EventsCodeGenerationContext::ObjectAlreadyDeclaredByParents(
+    const gd::String& objectName) const {
+  for (auto objectsLists = parentObjectsLists.get(); objectsLists;
+       objectsLists = objectsLists->parent.get()) {
+    if (objectsLists->declaredObjectsLists.find(objectName) !=
+        objectsLists->declaredObjectsLists.end())
+      return true;
+  }
+
+  return false;
+}
+
+std::set<gd::String>
+EventsCodeGenerationContext::GetObjectsListsAlreadyDeclaredByParents() const {
+  std::set<gd::String> alreadyDeclaredObjectsLists;
+  for (auto objectsLists = parentObjectsLists.get(); objectsLists;
+       objectsLists = objectsLists->parent.get()) {
+    alreadyDeclaredObjectsLists.insert(
+        objectsLists->declaredObjectsLists.begin(),
+        objectsLists->declaredObjectsLists.end());
+  }
+
+  return alreadyDeclaredObjectsLists;
+}
+
 std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
     const {
   std::set<gd::String> allObjectListsToBeDeclared(
@@ -117,7 +142,16 @@ std::set<gd::String> EventsCodeGenerationContext::GetAllObjectsToBeDeclared()
 
 unsigned int EventsCodeGenerationContext::GetLastDepthObjectListWasNeeded(
     const gd::String& name) const {
-  if (depthOfLastUse.count(name) != 0) return depthOfLastUse.find(name)->second;
+  auto it = depthOfLastUse.find(name);
+  if (it != depthOfLastUse.end()) return it->second;
+
+  // The nearest parent where the object was used has the last depth.
+  for (auto objectsLists = parentObjectsLists.get(); objectsLists;
+       objectsLists = objectsLists->parent.get()) {
+    auto parentIt = objectsLists->depthOfLastUse.find(name);
+    if (parentIt != objectsLists->depthOfLastUse.end())
+      return parentIt->second;
+  }
 
   std::cout << "WARNING: During code generation, the last depth of an object "
                "list was 0."
@@ -139,10 +139,7 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return true if an object list has already been declared by the parent contexts.
    */
-  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const {
-    return (alreadyDeclaredObjectsLists.find(objectName) !=
-            alreadyDeclaredObjectsLists.end());
-  };
+  bool ObjectAlreadyDeclaredByParents(const gd::String& objectName) const;
 
   /**
    * Return all the objects lists which will be declared by the current context
@@ -178,10 +175,11 @@ class GD_CORE_API EventsCodeGenerationContext {
   /**
    * Return the objects lists which are already declared and can be used in the
    * current context without declaration.
+   *
+   * \note Prefer ObjectAlreadyDeclaredByParents to check a single object, as
+   * this builds a new set.
    */
-  const std::set<gd::String>& GetObjectsListsAlreadyDeclaredByParents() const {
-    return alreadyDeclaredObjectsLists;
-  };
+  std::set<gd::String> GetObjectsListsAlreadyDeclaredByParents() const;
 
   /**
    * \brief Get the depth of the context that was in effect when \a objectName
@@ -269,11 +267,26 @@ class GD_CORE_API EventsCodeGenerationContext {
   };
 
  private:
+  /**
+   * \brief The objects lists declared by a parent context, and the depth at
+   * which they were last needed in it.
+   *
+   * A context does not copy the objects lists of its parents: it keeps a
+   * pointer to these (immutable) snapshots, shared with its siblings and
+   * children. Only the lists declared or used in the parent itself are copied
+   * when a child is created.
+   */
+  struct ParentObjectsLists {
+    std::shared_ptr<const ParentObjectsLists> parent;
+    std::set<gd::String> declaredObjectsLists;
+    std::map<gd::String, unsigned int> depthOfLastUse;
+  };
+
   void NotifyAsyncParentsAboutDeclaredObject(const gd::String& objectName);
 
-  std::set<gd::String>
-      alreadyDeclaredObjectsLists;  ///< Objects lists already needed in a
-                                    ///< parent context.
+  std::shared_ptr<const ParentObjectsLists>
+      parentObjectsLists;  ///< Objects lists already needed in the parent
+                           ///< contexts, from the nearest one.
   std::set<gd::String>
       objectsListsToBeDeclared;  ///< Objects lists that will be declared in
                                  ///< this context.
@@ -298,7 +311,9 @@ class GD_CORE_API EventsCodeGenerationContext {
                                                  ///< backed up.
 
   std::map<gd::String, unsigned int>
-      depthOfLastUse;  ///< The context depth when an object was last used.
+      depthOfLastUse;  ///< The context depth when an object was last used
+                       ///< in this context (see parentObjectsLists for the
+                       ///< parents).
   gd::String
       currentObject;  ///< The object being used by an action or condition.
   unsigned int contextDepth = 0;  ///< The depth of the context: 0 for a newly
@@ -163,14 +163,15 @@ gd::String EventsCodeGenerator::GenerateOperatorCall(
     if (i == operatorIndex + 1) {
       if (!argumentsStr.empty()) argumentsStr += ", ";
       if (operatorStr != "=")
-        argumentsStr += getterStartString + "(" + getterArgumentsStr + ") " +
-                        operatorStr + " (" + rhs + ")";
+        argumentsStr += gd::String::Concat(getterStartString, "(",
+                                           getterArgumentsStr, ") ",
+                                           operatorStr, " (", rhs, ")");
       else
         argumentsStr += rhs;
     }
   }
 
-  return callStartString + "(" + argumentsStr + ")";
+  return gd::String::Concat(callStartString, "(", argumentsStr, ")");
 }
 
 /**
@@ -232,8 +233,8 @@ gd::String EventsCodeGenerator::GenerateCompoundOperatorCall(
     }
   }
 
-  return callStartString + "(" + argumentsStr + ") " + operatorStr + " (" +
-         rhs + ")";
+  return gd::String::Concat(
+      callStartString, "(", argumentsStr, ") ", operatorStr, " (", rhs, ")");
 }
 
 gd::String EventsCodeGenerator::GenerateMutatorCall(
@@ -291,7 +292,8 @@ gd::String EventsCodeGenerator::GenerateConditionCode(
   gd::String conditionCode;
 
   const gd::InstructionMetadata& instrInfos =
-      MetadataProvider::GetConditionMetadata(platform, condition.GetType());
+      MetadataProvider::GetConditionMetadata(
+          platform, condition.GetTypeSymbol());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
     return "/* Unknown instruction - skipped. */";
   }
@@ -467,7 +469,7 @@ gd::String EventsCodeGenerator::GenerateActionCode(
   gd::String actionCode;
 
   const gd::InstructionMetadata& instrInfos =
-      MetadataProvider::GetActionMetadata(platform, action.GetType());
+      MetadataProvider::GetActionMetadata(platform, action.GetTypeSymbol());
   if (MetadataProvider::IsBadInstructionMetadata(instrInfos)) {
     return "/* Unknown instruction - skipped. */";
   }
@@ -603,7 +605,7 @@ EventsCodeGenerator::GenerateCallback(
   if (subEvents != nullptr)  // Sub events
   {
     actionsCode += "\n{ //Subevents\n";
-    actionsCode += GenerateEventsListCode(*subEvents, callbackContext);
+    AppendEventsListCode(*subEvents, callbackContext, actionsCode);
     actionsCode += "} //End of subevents\n";
   }
 
@@ -611,10 +613,13 @@ EventsCodeGenerator::GenerateCallback(
   const gd::String actionsDeclarationsCode =
       GenerateObjectsDeclarationCode(callbackContext);
 
-  const gd::String callbackCode = callbackFunctionName + " = function (" +
-                                  GenerateEventsParameters(callbackContext) +
-                                  ") {\n" + actionsDeclarationsCode +
-                                  actionsCode + "}\n";
+  gd::String callbackCode = callbackFunctionName;
+  callbackCode += " = function (";
+  callbackCode += GenerateEventsParameters(callbackContext);
+  callbackCode += ") {\n";
+  callbackCode += actionsDeclarationsCode;
+  callbackCode += actionsCode;
+  callbackCode += "}\n";
 
   AddCustomCodeOutsideMain(callbackCode);
 
@@ -861,9 +866,10 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
 /**
  * Generate events list code.
  */
-gd::String EventsCodeGenerator::GenerateEventsListCode(
-    gd::EventsList& events, EventsCodeGenerationContext& parentContext) {
-  gd::String output;
+void EventsCodeGenerator::AppendEventsListCode(
+    gd::EventsList& events,
+    EventsCodeGenerationContext& parentContext,
+    gd::String& output) {
   for (std::size_t eId = 0; eId < events.size(); ++eId) {
     // Each event has its own context : Objects picked in an event are totally
     // different than the one picked in another.
@@ -890,11 +896,18 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
     gd::String scopeEnd = GenerateScopeEnd(context);
     gd::String declarationsCode = GenerateObjectsDeclarationCode(context);
 
-    output += "\n" + scopeBegin + "\n" + declarationsCode + "\n" +
-              eventCoreCode + "\n" + scopeEnd + "\n";
+    // Append each part to the output, without concatenating them first, as
+    // the code of the event can be large (it includes its sub-events).
+    output += "\n";
+    output += scopeBegin;
+    output += "\n";
+    output += declarationsCode;
+    output += "\n";
+    output += eventCoreCode;
+    output += "\n";
+    output += scopeEnd;
+    output += "\n";
   }
-
-  return output;
 }
 
 gd::String EventsCodeGenerator::ConvertToString(gd::String plainString) {
@@ -77,9 +77,31 @@ class GD_CORE_API EventsCodeGenerator {
    * \param events std::vector of events
    * \param context Context used for generation
    * \return Code
+   *
+   * \see AppendEventsListCode
+   */
+  gd::String GenerateEventsListCode(gd::EventsList& events,
+                                    EventsCodeGenerationContext& context) {
+    gd::String output;
+    AppendEventsListCode(events, context, output);
+    return output;
+  };
+
+  /**
+   * \brief Generate code for executing an event list, appending it to the
+   * given output.
+   *
+   * Prefer it to GenerateEventsListCode when the code of the events is added
+   * to a bigger code (like the code of a parent event), as it avoids to copy
+   * the code of the events (and of their sub-events) once more.
+   *
+   * \param events std::vector of events
+   * \param context Context used for generation
+   * \param output The code to which the code of the events is appended.
    */
-  virtual gd::String GenerateEventsListCode(
-      gd::EventsList& events, EventsCodeGenerationContext& context);
+  virtual void AppendEventsListCode(gd::EventsList& events,
+                                    EventsCodeGenerationContext& context,
+                                    gd::String& output);
 
   /**
    * \brief Generate code for executing a condition list
@@ -280,7 +302,7 @@ class GD_CORE_API EventsCodeGenerator {
   /**
    * \brief Add some code before events outside the main function.
    */
-  void AddCustomCodeOutsideMain(gd::String code) {
+  void AddCustomCodeOutsideMain(const gd::String& code) {
     customCodeOutsideMain += code;
   };
 
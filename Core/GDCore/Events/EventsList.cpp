@@ -8,9 +8,65 @@
 
 #include "GDCore/Events/Event.h"
 #include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
 #include "GDCore/Tools/Log.h"
 #include "Serialization.h"
 
+namespace {
+bool IsWordCharacter(char character) {
+  // Bytes of UTF-8 encoded non-ASCII characters are all considered as part of
+  // words.
+  return (character >= 'a' && character <= 'z') ||
+         (character >= 'A' && character <= 'Z') ||
+         (character >= '0' && character <= '9') || character == '_' ||
+         static_cast<unsigned char>(character) >= 128;
+}
+
+/**
+ * Call the function with each word of the text, stopping if it returns false.
+ * \return false if the function returned false.
+ */
+template <typename Function>
+bool ForEachWord(const std::string& text, Function function) {
+  std::size_t wordStart = 0;
+  for (std::size_t i = 0; i <= text.size(); ++i) {
+    if (i < text.size() && IsWordCharacter(text[i])) continue;
+
+    if (i > wordStart && !function(text.substr(wordStart, i - wordStart)))
+      return false;
+    wordStart = i + 1;
+  }
+  return true;
+}
+
+void AddWords(const std::string& text,
+              std::unordered_set<std::string>& words) {
+  ForEachWord(text, [&words](std::string word) {
+    words.insert(std::move(word));
+    return true;
+  });
+}
+
+void AddWords(const gd::SerializerValue& value,
+              std::unordered_set<std::string>& words) {
+  if (value.IsBoolean() || value.IsInt() || value.IsDouble()) return;
+  AddWords(value.GetRawString().Raw(), words);
+}
+
+void AddWords(const gd::SerializerElement& element,
+              std::unordered_set<std::string>& words) {
+  if (!element.IsValueUndefined()) AddWords(element.GetValue(), words);
+  for (const auto& attribute : element.GetAllAttributes()) {
+    AddWords(attribute.first.Raw(), words);
+    AddWords(attribute.second, words);
+  }
+  for (const auto& child : element.GetAllChildren()) {
+    AddWords(child.first.Raw(), words);
+    if (child.second) AddWords(*child.second, words);
+  }
+}
+}  // namespace
+
 namespace gd {
 
 EventsList::EventsList() {}
@@ -88,6 +144,25 @@ void EventsList::UnserializeFrom(gd::Project& project,
   EventsListSerialization::UnserializeEventsFrom(project, *this, element);
 }
 
+void EventsList::IndexSymbols() {
+  // The serialized events contain all the strings that can reference
+  // something in the project, whatever the type of the events.
+  gd::SerializerElement element;
+  SerializeTo(element);
+
+  auto words = std::make_shared<std::unordered_set<std::string>>();
+  AddWords(element, *words);
+  symbols = words;
+}
+
+bool EventsList::MayUseSymbol(const gd::String& symbol) const {
+  if (!symbols) return true;
+
+  return ForEachWord(symbol.Raw(), [this](const std::string& word) {
+    return symbols->find(word) != symbols->end();
+  });
+}
+
 bool EventsList::Contains(const gd::BaseEvent& eventToSearch,
                           bool recursive) const {
   for (std::size_t i = 0; i < GetEventsCount(); ++i) {
@@ -128,6 +203,7 @@ void EventsList::Init(const gd::EventsList& other) {
   events.clear();
   for (size_t i = 0; i < other.events.size(); ++i)
     events.push_back(CloneRememberingOriginalEvent(other.events[i]));
+  symbols = other.symbols;
 }
 
 }  // namespace gd
@@ -7,6 +7,8 @@
 #ifndef GDCORE_EVENTSLIST_H
 #define GDCORE_EVENTSLIST_H
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 #include "GDCore/String.h"
 namespace gd {
@@ -190,6 +192,44 @@ class GD_CORE_API EventsList {
   };
   ///@}
 
+  /** \name Symbols index
+   * Members functions related to the index of the symbols (names of objects,
+   * behaviors, variables, layers, functions...) used in the events list.
+   *
+   * Refactoring tools use it to skip the events lists that can't use a
+   * renamed or removed element, without visiting their events and parsing
+   * their expressions (see gd::ArbitraryEventsWorker).
+   */
+  ///@{
+  /**
+   * \brief Index the symbols used by the events (including sub-events).
+   *
+   * \warning The index is not updated automatically when the events are
+   * modified: call this again after editing the events (refactoring tools
+   * update the index of the events lists they visit).
+   */
+  void IndexSymbols();
+
+  /**
+   * \brief Remove the index of the symbols used by the events.
+   */
+  void ClearSymbolsIndex() { symbols.reset(); }
+
+  /**
+   * \brief Return true if the symbols used by the events are indexed.
+   */
+  bool HasSymbolsIndex() const { return symbols != nullptr; }
+
+  /**
+   * \brief Return false if the events can't use the specified symbol according
+   * to the index, true otherwise (including when the events are not indexed).
+   *
+   * \note The index stores words, so this can return true for a symbol that
+   * is only part of a longer name, or of a string.
+   */
+  bool MayUseSymbol(const gd::String& symbol) const;
+  ///@}
+
   /** \name Saving and loading
    * Members functions related to saving and loading the events list.
    */
@@ -209,6 +249,9 @@ class GD_CORE_API EventsList {
 
  private:
   std::vector<std::shared_ptr<BaseEvent> > events;
+  std::shared_ptr<const std::unordered_set<std::string> >
+      symbols;  ///< The words used in the events, if indexed. Shared by the
+                ///< copies of the list.
 
   /**
    * Initialize from another list of events, copying events. Used by copy-ctor
@@ -6,6 +6,7 @@
 
 #include "GDCore/Events/Expression.h"
 
+#include "GDCore/Events/Parsers/ExpressionNodeCache.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
 #include "GDCore/String.h"
 
@@ -20,22 +21,34 @@ Expression::Expression(const char* plainString_)
     : node(nullptr), plainString(plainString_) {};
 
 Expression::Expression(const Expression& copy)
-    : node(nullptr), plainString{copy.plainString} {};
+    : node(std::atomic_load(&copy.node)), plainString{copy.plainString} {};
 
 Expression& Expression::operator=(const Expression& expression) {
   plainString = expression.plainString;
-  node = nullptr;
+  std::atomic_store(&node, std::atomic_load(&expression.node));
   return *this;
 };
 
 Expression::~Expression(){};
 
 ExpressionNode* Expression::GetRootNode() const {
-  if (!node) {
-    gd::ExpressionParser2 parser = ExpressionParser2();
-    node = std::move(parser.ParseExpression(plainString));
+  std::shared_ptr<gd::ExpressionNode> rootNode = std::atomic_load(&node);
+  if (!rootNode) {
+    // The tree is parsed on first use, possibly by several threads reading
+    // the expression at the same time: only the first tree is kept, so the
+    // returned node stays alive as long as the expression is not modified.
+    std::shared_ptr<gd::ExpressionNode> parsedRootNode =
+        gd::ExpressionNodeCache::Get()->GetRootNode(plainString);
+    if (std::atomic_compare_exchange_strong(&node, &rootNode, parsedRootNode))
+      rootNode = parsedRootNode;
   }
-  return node.get();
+  return rootNode.get();
+}
+
+std::unique_ptr<gd::ExpressionNode> Expression::ParseModifiableRootNode()
+    const {
+  gd::ExpressionParser2 parser = ExpressionParser2();
+  return parser.ParseExpression(plainString);
 }
 
 }  // namespace gd
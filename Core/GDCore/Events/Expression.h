@@ -23,6 +23,10 @@ namespace gd {
  * gd::Instruction. This class is nothing more than a wrapper around a
  * gd::String.
  *
+ * The tree of the parsed expression is shared by the copies of the expression
+ * and by the expressions having the same plain string.
+ *
+ * \see gd::ExpressionNodeCache
  * \see gd::Instruction
  *
  * \ingroup Events
@@ -60,11 +64,23 @@ class GD_CORE_API Expression {
   inline const gd::String& GetPlainString() const { return plainString; };
 
   /**
-   * @brief Get the expression node.
-   * @return std::unique_ptr<gd::ExpressionNode>
+   * \brief Get the root node of the tree of the parsed expression.
+   *
+   * The tree is parsed on first use. It can be done from several threads
+   * reading the expression at the same time.
+   *
+   * \warning The tree is shared with other expressions and must not be
+   * modified: use ParseModifiableRootNode to modify it.
    */
   gd::ExpressionNode* GetRootNode() const;
 
+  /**
+   * \brief Parse the expression into a new tree, owned by the caller, that
+   * can be modified (for example to rename something before printing it back
+   * into an expression).
+   */
+  std::unique_ptr<gd::ExpressionNode> ParseModifiableRootNode() const;
+
   /**
    * \brief Mimics std::string::c_str
    */
@@ -74,7 +90,8 @@ class GD_CORE_API Expression {
 
  private:
   gd::String plainString;  ///< The expression string
-  mutable std::unique_ptr<gd::ExpressionNode> node;
+  mutable std::shared_ptr<gd::ExpressionNode>
+      node;  ///< The parsed expression, shared with other expressions.
 };
 
 }  // namespace gd
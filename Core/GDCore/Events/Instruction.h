@@ -11,6 +11,7 @@
 #include "GDCore/Events/Expression.h"
 #include "GDCore/Events/InstructionsList.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 
 namespace gd {
 
@@ -54,11 +55,17 @@ class GD_CORE_API Instruction {
    */
   const gd::String& GetType() const { return type; }
 
+  /**
+   * \brief Return the type of the instruction, as an interned symbol (to find
+   * its metadata without hashing the type).
+   */
+  const gd::Symbol& GetTypeSymbol() const { return type; }
+
   /**
    * \brief Change the instruction type
    * \param val The new type of the instruction
    */
-  void SetType(const gd::String& newType) { type = newType; }
+  void SetType(const gd::String& newType) { type = gd::Symbol(newType); }
 
   /**
    * \brief Return true if the condition is inverted
@@ -168,7 +175,7 @@ class GD_CORE_API Instruction {
       std::shared_ptr<Instruction> instruction);
 
  private:
-  gd::String type;  ///< Instruction type
+  gd::Symbol type;  ///< Instruction type
   bool inverted;  ///< True if the instruction if inverted. Only applicable for
                   ///< instruction used as conditions by events
   bool awaitAsync =
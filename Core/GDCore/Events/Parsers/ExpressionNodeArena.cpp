@@ -0,0 +1,130 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionNodeArena.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace {
+/**
+ * Each allocation starts with a header storing the arena it comes from (or
+ * nullptr if allocated from the heap), keeping the memory after it aligned
+ * like memory returned by operator new.
+ */
+constexpr std::size_t headerSize = alignof(std::max_align_t);
+constexpr std::size_t maximumBlockSize = 64 * 1024;
+}  // namespace
+
+namespace gd {
+
+/**
+ * The blocks of an arena, kept alive by the arena itself and by each node
+ * allocated from it. The first block is allocated with the structure, just
+ * after it.
+ */
+struct ExpressionNodeArena::Blocks {
+  static Blocks* Create(std::size_t initialBlockSize) {
+    void* memory = ::operator new(firstBlockOffset + initialBlockSize);
+    return new (memory) Blocks(initialBlockSize);
+  }
+
+  void* Allocate(std::size_t size) {
+    size = (size + headerSize - 1) / headerSize * headerSize;
+    if ((std::size_t)(end - current) < size) {
+      std::size_t blockSize = std::max(size, nextBlockSize);
+      blocks.emplace_back(new char[blockSize]);
+      current = blocks.back().get();
+      end = current + blockSize;
+      nextBlockSize = std::min(nextBlockSize * 2, maximumBlockSize);
+    }
+
+    void* allocated = current;
+    current += size;
+    return allocated;
+  }
+
+  void Release() {
+    if (--referencesCount == 0) {
+      this->~Blocks();
+      ::operator delete(this);
+    }
+  }
+
+  std::size_t GetBlocksCount() const { return 1 + blocks.size(); }
+
+  Blocks(std::size_t initialBlockSize)
+      : referencesCount(1),
+        current(reinterpret_cast<char*>(this) + firstBlockOffset),
+        end(current + initialBlockSize),
+        nextBlockSize(std::min(initialBlockSize * 2, maximumBlockSize)) {}
+
+  std::atomic<std::size_t> referencesCount;
+  static const std::size_t firstBlockOffset;
+
+  std::vector<std::unique_ptr<char[]>> blocks;  ///< The blocks after the first.
+  char* current;  ///< The next free byte in the current block.
+  char* end;      ///< The end of the current block.
+  std::size_t nextBlockSize;
+};
+
+const std::size_t ExpressionNodeArena::Blocks::firstBlockOffset =
+    (sizeof(ExpressionNodeArena::Blocks) + headerSize - 1) / headerSize *
+    headerSize;
+
+namespace {
+/**
+ * The blocks of the arena used by the current thread (see
+ * ExpressionNodeArena::Scope), if any.
+ */
+thread_local void* currentBlocks = nullptr;
+}  // namespace
+
+ExpressionNodeArena::ExpressionNodeArena(std::size_t initialBlockSize)
+    : blocks(Blocks::Create(
+          std::max(initialBlockSize, (std::size_t)(4 * headerSize)))) {}
+
+ExpressionNodeArena::~ExpressionNodeArena() { blocks->Release(); }
+
+std::size_t ExpressionNodeArena::GetBlocksCount() const {
+  return blocks->GetBlocksCount();
+}
+
+ExpressionNodeArena::Scope::Scope(ExpressionNodeArena& arena)
+    : previousBlocks(currentBlocks) {
+  currentBlocks = arena.blocks;
+}
+
+ExpressionNodeArena::Scope::~Scope() { currentBlocks = previousBlocks; }
+
+void* ExpressionNodeArena::AllocateNode(std::size_t size) {
+  Blocks* blocks = static_cast<Blocks*>(currentBlocks);
+  char* memory;
+  if (blocks) {
+    memory = static_cast<char*>(blocks->Allocate(headerSize + size));
+    blocks->referencesCount++;
+  } else {
+    memory = static_cast<char*>(::operator new(headerSize + size));
+  }
+
+  *reinterpret_cast<Blocks**>(memory) = blocks;
+  return memory + headerSize;
+}
+
+void ExpressionNodeArena::DeallocateNode(void* memory) noexcept {
+  if (!memory) return;
+
+  char* allocatedMemory = static_cast<char*>(memory) - headerSize;
+  Blocks* blocks = *reinterpret_cast<Blocks**>(allocatedMemory);
+  if (blocks)
+    blocks->Release();
+  else
+    ::operator delete(allocatedMemory);
+}
+
+}  // namespace gd
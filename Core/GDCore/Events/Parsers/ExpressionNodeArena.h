@@ -0,0 +1,80 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONNODEARENA_H
+#define GDCORE_EXPRESSIONNODEARENA_H
+
+#include <cstddef>
+
+namespace gd {
+
+/**
+ * \brief A monotonic memory arena from which the nodes of parsed expressions
+ * (and their diagnostics) can be allocated.
+ *
+ * Nodes are still owned by their parent (or by the caller for the root node)
+ * and destroyed as usual, but their memory is not given back individually:
+ * the blocks of the arena are freed at once when the arena is destroyed
+ * and all the nodes allocated from it are destroyed. Nodes can outlive the
+ * arena object and be moved from a tree to another.
+ *
+ * \note Nodes must be allocated from a single thread, but can be destroyed
+ * from any thread.
+ *
+ * \see gd::ExpressionParser2::UseArenaAllocation
+ */
+class GD_CORE_API ExpressionNodeArena {
+ public:
+  /**
+   * \param initialBlockSize The size of the first block of memory, the next
+   * ones being bigger.
+   */
+  ExpressionNodeArena(std::size_t initialBlockSize = 1024);
+  virtual ~ExpressionNodeArena();
+
+  /**
+   * \brief Return the number of blocks allocated from the system.
+   */
+  std::size_t GetBlocksCount() const;
+
+  /**
+   * \brief Make the nodes created by the current thread allocated from an
+   * arena, as long as the scope is alive.
+   */
+  class GD_CORE_API Scope {
+   public:
+    Scope(ExpressionNodeArena& arena);
+    ~Scope();
+
+   private:
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    void* previousBlocks;
+  };
+
+  /**
+   * \brief Allocate the memory of a node, from the arena of the current
+   * thread if any (see gd::ExpressionNodeArena::Scope) or from the heap
+   * otherwise.
+   */
+  static void* AllocateNode(std::size_t size);
+
+  /**
+   * \brief Free the memory of a node allocated with AllocateNode.
+   */
+  static void DeallocateNode(void* memory) noexcept;
+
+ private:
+  ExpressionNodeArena(const ExpressionNodeArena&) = delete;
+  ExpressionNodeArena& operator=(const ExpressionNodeArena&) = delete;
+
+  struct Blocks;
+  Blocks* blocks;  ///< The memory of the arena, shared with the nodes.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONNODEARENA_H
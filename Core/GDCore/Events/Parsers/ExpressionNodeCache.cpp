@@ -0,0 +1,103 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionNodeCache.h"
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+
+namespace gd {
+
+ExpressionNodeCache* ExpressionNodeCache::_singleton = nullptr;
+
+ExpressionNodeCache::ExpressionNodeCache()
+    : size(0), maximumSize(4 * 1024 * 1024), hitsCount(0), missesCount(0) {}
+
+std::shared_ptr<gd::ExpressionNode> ExpressionNodeCache::GetRootNode(
+    const gd::String& plainString) {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = entriesByPlainString.find(plainString);
+    if (it != entriesByPlainString.end()) {
+      hitsCount++;
+      entries.splice(entries.begin(), entries, it->second);
+      return it->second->second;
+    }
+    missesCount++;
+  }
+
+  // Parse without holding the lock, so that other threads can use the cache.
+  gd::ExpressionParser2 parser;
+  std::shared_ptr<gd::ExpressionNode> node =
+      parser.ParseExpression(plainString);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = entriesByPlainString.find(plainString);
+  if (it != entriesByPlainString.end()) {
+    // Another thread parsed the same expression in the meantime.
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second;
+  }
+
+  entries.emplace_front(plainString, node);
+  entriesByPlainString[plainString] = entries.begin();
+  size += plainString.Raw().size();
+  RemoveExceedingEntries();
+  return node;
+}
+
+void ExpressionNodeCache::SetMaximumSize(std::size_t maximumSize_) {
+  std::lock_guard<std::mutex> lock(mutex);
+  maximumSize = maximumSize_;
+  RemoveExceedingEntries();
+}
+
+std::size_t ExpressionNodeCache::GetSize() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return size;
+}
+
+std::size_t ExpressionNodeCache::GetHitsCount() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return hitsCount;
+}
+
+std::size_t ExpressionNodeCache::GetMissesCount() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return missesCount;
+}
+
+void ExpressionNodeCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+  entriesByPlainString.clear();
+  size = 0;
+  hitsCount = 0;
+  missesCount = 0;
+}
+
+void ExpressionNodeCache::RemoveExceedingEntries() {
+  while (size > maximumSize && !entries.empty()) {
+    const gd::String& plainString = entries.back().first;
+    size -= plainString.Raw().size();
+    entriesByPlainString.erase(plainString);
+    entries.pop_back();
+  }
+}
+
+ExpressionNodeCache* ExpressionNodeCache::Get() {
+  if (nullptr == _singleton) _singleton = new ExpressionNodeCache;
+
+  return _singleton;
+}
+
+void ExpressionNodeCache::DestroySingleton() {
+  if (nullptr != _singleton) {
+    delete _singleton;
+    _singleton = nullptr;
+  }
+}
+
+}  // namespace gd
@@ -0,0 +1,114 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_EXPRESSIONNODECACHE_H
+#define GDCORE_EXPRESSIONNODECACHE_H
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "GDCore/String.h"
+namespace gd {
+struct ExpressionNode;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief Cache of the trees of the parsed expressions, indexed by the plain
+ * string of the expressions.
+ *
+ * Parsing an expression only depends on its plain string, so the same tree
+ * can be shared by all the gd::Expression having the same plain string. This
+ * avoids parsing again all the expressions of events that are copied (when a
+ * project, a scene or an event is copied or when events are preprocessed for
+ * code generation).
+ *
+ * The trees are kept until the total length of the cached expressions exceeds
+ * the maximum size of the cache, in which case the least recently used trees
+ * are removed from the cache (they are still alive as long as they are used
+ * by an expression).
+ *
+ * \warning The trees are shared and must not be modified.
+ *
+ * \see gd::Expression
+ */
+class GD_CORE_API ExpressionNodeCache {
+ public:
+  /**
+   * \brief Return the tree of the given expression, parsing it if it's not
+   * in the cache. It can be called from several threads.
+   */
+  std::shared_ptr<gd::ExpressionNode> GetRootNode(
+      const gd::String& plainString);
+
+  /**
+   * \brief Set the maximum total length (in bytes) of the expressions for
+   * which a tree is kept in the cache.
+   */
+  void SetMaximumSize(std::size_t maximumSize_);
+
+  /**
+   * \brief Return the maximum total length (in bytes) of the expressions for
+   * which a tree is kept in the cache.
+   */
+  std::size_t GetMaximumSize() const { return maximumSize; }
+
+  /**
+   * \brief Return the total length (in bytes) of the expressions for which a
+   * tree is in the cache.
+   */
+  std::size_t GetSize() const;
+
+  /**
+   * \brief Return the number of trees that were found in the cache.
+   */
+  std::size_t GetHitsCount() const;
+
+  /**
+   * \brief Return the number of trees that were parsed because they were not
+   * in the cache.
+   */
+  std::size_t GetMissesCount() const;
+
+  /**
+   * \brief Remove all the trees from the cache and reset the counters.
+   */
+  void Clear();
+
+  static ExpressionNodeCache* Get();
+  static void DestroySingleton();
+
+ private:
+  typedef std::pair<gd::String, std::shared_ptr<gd::ExpressionNode>>
+      CacheEntry;
+
+  ExpressionNodeCache();
+  virtual ~ExpressionNodeCache(){};
+  static ExpressionNodeCache* _singleton;
+
+  /**
+   * \brief Remove the least recently used trees until the cache fits in its
+   * maximum size.
+   */
+  void RemoveExceedingEntries();
+
+  std::list<CacheEntry> entries;  ///< The trees, the most recently used first.
+  std::unordered_map<gd::String, std::list<CacheEntry>::iterator>
+      entriesByPlainString;
+  std::size_t size;
+  std::size_t maximumSize;
+  std::size_t hitsCount;
+  std::size_t missesCount;
+  mutable std::mutex mutex;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_EXPRESSIONNODECACHE_H
@@ -29,8 +29,7 @@ namespace gd {
 gd::String ExpressionParser2::NAMESPACE_SEPARATOR = "::";
 
 ExpressionParser2::ExpressionParser2()
-    : expression(""),
-      currentPosition(0) {}
+    : currentPosition(0) {}
 
 std::unique_ptr<TextNode> ExpressionParser2::ReadText() {
   size_t textStartPosition = GetCurrentPosition();
@@ -142,4 +141,248 @@ std::unique_ptr<NumberNode> ExpressionParser2::ReadNumber() {
   return number;
 }
 
+namespace {
+/**
+ * \brief Find the nodes that were parsed by ExpressionParser2::Expression
+ * (parameters of functions, sub-expressions, right operands of "+", "-"...
+ * and expressions of bracket accessors) and that contain an edit.
+ */
+class EditedExpressionsFinder : public ExpressionParser2NodeWorker {
+ public:
+  EditedExpressionsFinder(size_t editStartPosition_,
+                          size_t editPreviousEndPosition_)
+      : editStartPosition(editStartPosition_),
+        editPreviousEndPosition(editPreviousEndPosition_){};
+  virtual ~EditedExpressionsFinder(){};
+
+  /**
+   * \brief Return the nodes containing the edit, the outermost first.
+   */
+  const std::vector<std::unique_ptr<ExpressionNode> *> &GetEditedExpressions()
+      const {
+    return editedExpressions;
+  }
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    VisitExpression(node.expression);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    VisitIfEdited(*node.leftHandSide);
+    // "*" and "/" have factors as operands, not expressions.
+    if (IsExpressionOperator(node.op))
+      VisitExpression(node.rightHandSide);
+    else
+      VisitIfEdited(*node.rightHandSide);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    VisitIfEdited(*node.factor);
+  }
+  void OnVisitNumberNode(NumberNode &node) override {}
+  void OnVisitTextNode(TextNode &node) override {}
+  void OnVisitVariableNode(VariableNode &node) override {
+    if (node.child) VisitIfEdited(*node.child);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    if (node.child) VisitIfEdited(*node.child);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    VisitExpression(node.expression);
+    if (node.child) VisitIfEdited(*node.child);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {}
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {}
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    for (auto &parameter : node.parameters) VisitExpression(parameter);
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override {}
+
+ private:
+  bool ContainsEdit(const ExpressionNode &node) {
+    return node.location.IsValid() &&
+           node.location.GetStartPosition() <= editStartPosition &&
+           editPreviousEndPosition <= node.location.GetEndPosition();
+  }
+
+  void VisitIfEdited(ExpressionNode &node) {
+    if (ContainsEdit(node)) node.Visit(*this);
+  }
+
+  void VisitExpression(std::unique_ptr<ExpressionNode> &node) {
+    if (!ContainsEdit(*node)) return;
+
+    // The first character of an expression is looked at by the parent
+    // nodes (for example to know if a parameter is empty), so it must not be
+    // edited. Sub-expression nodes don't include their parentheses, so only
+    // their own expression can be parsed again.
+    if (node->location.GetStartPosition() < editStartPosition &&
+        !dynamic_cast<SubExpressionNode *>(node.get()))
+      editedExpressions.push_back(&node);
+
+    node->Visit(*this);
+  }
+
+  size_t editStartPosition;
+  size_t editPreviousEndPosition;
+  std::vector<std::unique_ptr<ExpressionNode> *> editedExpressions;
+};
+
+/**
+ * \brief Move the locations of the nodes (and their diagnostics) that are
+ * after an edit.
+ */
+class ExpressionLocationsShifter : public ExpressionParser2NodeWorker {
+ public:
+  /**
+   * \param fromPosition_ The first position to move.
+   * \param offset_ The offset to apply.
+   * \param skippedNode_ A node (and its children) not to move, because it
+   * was parsed from the edited expression.
+   */
+  ExpressionLocationsShifter(size_t fromPosition_,
+                             std::ptrdiff_t offset_,
+                             const ExpressionNode &skippedNode_)
+      : fromPosition(fromPosition_),
+        offset(offset_),
+        skippedNode(skippedNode_){};
+  virtual ~ExpressionLocationsShifter(){};
+
+ protected:
+  void OnVisitSubExpressionNode(SubExpressionNode &node) override {
+    if (!Shift(node)) return;
+    node.expression->Visit(*this);
+  }
+  void OnVisitOperatorNode(OperatorNode &node) override {
+    if (!Shift(node)) return;
+    node.leftHandSide->Visit(*this);
+    node.rightHandSide->Visit(*this);
+  }
+  void OnVisitUnaryOperatorNode(UnaryOperatorNode &node) override {
+    if (!Shift(node)) return;
+    node.factor->Visit(*this);
+  }
+  void OnVisitNumberNode(NumberNode &node) override { Shift(node); }
+  void OnVisitTextNode(TextNode &node) override { Shift(node); }
+  void OnVisitVariableNode(VariableNode &node) override {
+    if (!Shift(node)) return;
+    Shift(node.nameLocation);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableAccessorNode(VariableAccessorNode &node) override {
+    if (!Shift(node)) return;
+    Shift(node.nameLocation);
+    Shift(node.dotLocation);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitVariableBracketAccessorNode(
+      VariableBracketAccessorNode &node) override {
+    if (!Shift(node)) return;
+    node.expression->Visit(*this);
+    if (node.child) node.child->Visit(*this);
+  }
+  void OnVisitIdentifierNode(IdentifierNode &node) override {
+    if (!Shift(node)) return;
+    Shift(node.identifierNameLocation);
+    Shift(node.identifierNameDotLocation);
+    Shift(node.childIdentifierNameLocation);
+  }
+  void OnVisitObjectFunctionNameNode(ObjectFunctionNameNode &node) override {
+    if (!Shift(node)) return;
+    Shift(node.objectNameLocation);
+    Shift(node.objectNameDotLocation);
+    Shift(node.objectFunctionOrBehaviorNameLocation);
+    Shift(node.behaviorNameNamespaceSeparatorLocation);
+    Shift(node.behaviorFunctionNameLocation);
+  }
+  void OnVisitFunctionCallNode(FunctionCallNode &node) override {
+    if (!Shift(node)) return;
+    Shift(node.functionNameLocation);
+    Shift(node.objectNameLocation);
+    Shift(node.objectNameDotLocation);
+    Shift(node.behaviorNameLocation);
+    Shift(node.behaviorNameNamespaceSeparatorLocation);
+    Shift(node.openingParenthesisLocation);
+    Shift(node.closingParenthesisLocation);
+    for (auto &parameter : node.parameters) parameter->Visit(*this);
+  }
+  void OnVisitEmptyNode(EmptyNode &node) override { Shift(node); }
+
+ private:
+  bool Shift(ExpressionNode &node) {
+    if (&node == &skippedNode) return false;
+
+    Shift(node.location);
+    if (node.diagnostic) node.diagnostic->ShiftLocation(fromPosition, offset);
+    return true;
+  }
+
+  void Shift(ExpressionParserLocation &location) {
+    location = location.Shifted(fromPosition, offset);
+  }
+
+  size_t fromPosition;
+  std::ptrdiff_t offset;
+  const ExpressionNode &skippedNode;
+};
+}  // namespace
+
+std::unique_ptr<ExpressionNode> ExpressionParser2::ParseEditedExpression(
+    const gd::String &expression_,
+    std::unique_ptr<ExpressionNode> previousRootNode,
+    size_t editStartPosition,
+    size_t editPreviousEndPosition,
+    size_t editEndPosition) {
+  if (!previousRootNode || editPreviousEndPosition < editStartPosition ||
+      editEndPosition < editStartPosition)
+    return ParseExpression(expression_);
+
+  expression = expression_.ToUTF32();
+  if (editEndPosition > expression.size()) return ParseExpression(expression_);
+  std::ptrdiff_t offset = (std::ptrdiff_t)editEndPosition -
+                          (std::ptrdiff_t)editPreviousEndPosition;
+
+  EditedExpressionsFinder finder(editStartPosition, editPreviousEndPosition);
+  previousRootNode->Visit(finder);
+  const auto &editedExpressions = finder.GetEditedExpressions();
+
+  // Parse again the innermost expression containing the edit if possible,
+  // otherwise the ones containing it.
+  for (auto it = editedExpressions.rbegin(); it != editedExpressions.rend();
+       ++it) {
+    std::unique_ptr<ExpressionNode> &editedExpression = **it;
+    size_t startPosition = editedExpression->location.GetStartPosition();
+    size_t previousEndPosition = editedExpression->location.GetEndPosition();
+
+    // The expression was ending before the first character after it that is
+    // not a whitespace. If it still ends before this character (which was
+    // not edited), the rest of the expression is parsed like before.
+    size_t expectedEndPosition = previousEndPosition + offset;
+    if (expectedEndPosition > expression.size()) continue;
+    while (expectedEndPosition < expression.size() &&
+           IsWhitespace(expression[expectedEndPosition]))
+      expectedEndPosition++;
+
+    currentPosition = startPosition;
+    std::unique_ptr<ExpressionNode> node;
+    if (arena) {
+      ExpressionNodeArena::Scope arenaScope(*arena);
+      node = Expression();
+    } else {
+      node = Expression();
+    }
+    if (currentPosition != expectedEndPosition) continue;
+
+    node->parent = editedExpression->parent;
+    editedExpression = std::move(node);
+
+    ExpressionLocationsShifter shifter(
+        previousEndPosition, offset, *editedExpression);
+    previousRootNode->Visit(shifter);
+    return previousRootNode;
+  }
+
+  return ParseExpression(expression_);
+}
+
 }  // namespace gd
@@ -7,6 +7,7 @@
 #define GDCORE_EXPRESSIONPARSER2_H
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -55,12 +56,64 @@ class GD_CORE_API ExpressionParser2 {
    */
   std::unique_ptr<ExpressionNode> ParseExpression(
       const gd::String &expression_) {
-    expression = expression_;
+    // Decode the expression once, so that characters can be accessed in
+    // constant time (gd::String is UTF-8 encoded).
+    expression = expression_.ToUTF32();
 
     currentPosition = 0;
+    if (!arena) return Start();
+
+    ExpressionNodeArena::Scope arenaScope(*arena);
     return Start();
   }
 
+  /**
+   * \brief Parse an edited expression, parsing again only the smallest part
+   * of the tree of the expression before the edit that contains the edit (a
+   * parameter of a function, a sub-expression, the operand of an operator or
+   * the expression of a bracket accessor).
+   *
+   * The other nodes of the previous tree are kept, with their locations
+   * moved according to the edit. If no part of the tree can be parsed again
+   * alone, the whole expression is parsed again.
+   *
+   * \param expression The expression after the edit.
+   * \param previousRootNode The tree of the expression before the edit.
+   * \param editStartPosition The position of the first edited character.
+   * \param editPreviousEndPosition The end of the edited characters, in the
+   * expression before the edit.
+   * \param editEndPosition The end of the edited characters, in the expression
+   * after the edit.
+   *
+   * \return The node representing the edited expression as a parsed tree
+   * (which is the previous root node, unless the whole expression was parsed
+   * again).
+   */
+  std::unique_ptr<ExpressionNode> ParseEditedExpression(
+      const gd::String &expression_,
+      std::unique_ptr<ExpressionNode> previousRootNode,
+      size_t editStartPosition,
+      size_t editPreviousEndPosition,
+      size_t editEndPosition);
+
+  /**
+   * \brief Allocate the nodes of the parsed trees from an arena, instead of
+   * allocating each node separately.
+   *
+   * This is useful when a lot of trees are parsed and destroyed together (for
+   * example the trees of all the expressions of an events sheet).
+   *
+   * \param arena_ The arena to allocate the parsed trees from, or null to
+   * allocate each node separately.
+   *
+   * \see gd::ExpressionNodeArena
+   */
+  ExpressionParser2 &UseArenaAllocation(
+      std::shared_ptr<ExpressionNodeArena> arena_) {
+    arena = arena_;
+    return *this;
+  }
+
   /**
    * Given an object name (or empty if none) and a behavior name (or empty if
    * none), return the index of the first parameter that is inside the
@@ -604,7 +657,7 @@ class GD_CORE_API ExpressionParser2 {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
     if (IsNamespaceSeparator()) {
-      currentPosition += NAMESPACE_SEPARATOR.size();
+      currentPosition += 2;
     }
 
     return ExpressionParserLocation(startPosition, currentPosition);
@@ -621,9 +674,9 @@ class GD_CORE_API ExpressionParser2 {
   bool IsNamespaceSeparator() {
     // Namespace separator is a special kind of delimiter as it is 2 characters
     // long
-    return (currentPosition + NAMESPACE_SEPARATOR.size() <= expression.size() &&
-            expression.substr(currentPosition, NAMESPACE_SEPARATOR.size()) ==
-                NAMESPACE_SEPARATOR);
+    return (currentPosition + 2 <= expression.size() &&
+            expression[currentPosition] == ':' &&
+            expression[currentPosition + 1] == ':');
   }
 
   bool IsEndReached() { return currentPosition >= expression.size(); }
@@ -635,35 +688,26 @@ class GD_CORE_API ExpressionParser2 {
   };
 
   IdentifierAndLocation ReadIdentifierName(bool allowDeprecatedSpacesInName = true) {
-    gd::String name;
     size_t startPosition = currentPosition;
+    size_t endPosition = currentPosition;
     while (currentPosition < expression.size() &&
            (CheckIfChar(IsAllowedInIdentifier)
             // Allow whitespace in identifier name for compatibility
             || (allowDeprecatedSpacesInName && expression[currentPosition] == ' '))) {
-      name += expression[currentPosition];
       currentPosition++;
-    }
 
-    // Trim whitespace at the end (we allow them for compatibility inside
-    // the name, but after the last character that is not whitespace, they
-    // should be ignore again).
-    if (!name.empty() && IsWhitespace(name[name.size() - 1])) {
-      size_t lastCharacterPos = name.size() - 1;
-      while (lastCharacterPos < name.size() &&
-             IsWhitespace(name[lastCharacterPos])) {
-        lastCharacterPos--;
-      }
-      if ((lastCharacterPos + 1) < name.size()) {
-        name.erase(lastCharacterPos + 1);
-      }
+      // Trim whitespace at the end (we allow them for compatibility inside
+      // the name, but after the last character that is not whitespace, they
+      // should be ignore again).
+      if (!IsWhitespace(expression[currentPosition - 1]))
+        endPosition = currentPosition;
     }
 
     IdentifierAndLocation identifierAndLocation{
-        name,
+        GetText(startPosition, endPosition),
         // The location is ignoring the trailing whitespace (only whitespace
         // inside the identifier are allowed for compatibility).
-        ExpressionParserLocation(startPosition, startPosition + name.size())};
+        ExpressionParserLocation(startPosition, endPosition)};
     return identifierAndLocation;
   }
 
@@ -673,14 +717,13 @@ class GD_CORE_API ExpressionParser2 {
 
   std::unique_ptr<EmptyNode> ReadUntilWhitespace() {
     size_t startPosition = GetCurrentPosition();
-    gd::String text;
     while (currentPosition < expression.size() &&
            !IsWhitespace(expression[currentPosition])) {
-      text += expression[currentPosition];
       currentPosition++;
     }
 
-    auto node = gd::make_unique<EmptyNode>(text);
+    auto node = gd::make_unique<EmptyNode>(
+        GetText(startPosition, GetCurrentPosition()));
     node->location =
         ExpressionParserLocation(startPosition, GetCurrentPosition());
     return node;
@@ -688,13 +731,10 @@ class GD_CORE_API ExpressionParser2 {
 
   std::unique_ptr<EmptyNode> ReadUntilEnd() {
     size_t startPosition = GetCurrentPosition();
-    gd::String text;
-    while (currentPosition < expression.size()) {
-      text += expression[currentPosition];
-      currentPosition++;
-    }
+    currentPosition = expression.size();
 
-    auto node = gd::make_unique<EmptyNode>(text);
+    auto node = gd::make_unique<EmptyNode>(
+        GetText(startPosition, GetCurrentPosition()));
     node->location =
         ExpressionParserLocation(startPosition, GetCurrentPosition());
     return node;
@@ -710,6 +750,14 @@ class GD_CORE_API ExpressionParser2 {
     return '\n';  // Should not arise, unless GetCurrentChar was called when
                   // IsEndReached() is true (which is a logical error).
   }
+
+  /**
+   * \brief Return the text of the expression between the two positions.
+   */
+  gd::String GetText(size_t startPosition, size_t endPosition) {
+    return gd::String::FromUTF32(
+        expression.substr(startPosition, endPosition - startPosition));
+  }
   ///@}
 
   /** \name Raising errors
@@ -729,9 +777,13 @@ class GD_CORE_API ExpressionParser2 {
   }
   ///@}
 
-  gd::String expression;
+  std::u32string expression;  ///< The characters of the expression being
+                              ///< parsed, decoded to allow constant time access.
   std::size_t currentPosition;
 
+  std::shared_ptr<ExpressionNodeArena>
+      arena;  ///< The arena used for the parsed trees, if any.
+
   static gd::String NAMESPACE_SEPARATOR;
 };
 
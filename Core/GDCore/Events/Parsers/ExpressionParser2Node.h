@@ -6,9 +6,11 @@
 #ifndef GDCORE_EXPRESSIONPARSER2NODES_H
 #define GDCORE_EXPRESSIONPARSER2NODES_H
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
+#include "ExpressionNodeArena.h"
 #include "ExpressionParser2NodeWorker.h"
 #include "GDCore/String.h"
 namespace gd {
@@ -23,7 +25,8 @@ struct FunctionCallNode;
 namespace gd {
 
 struct GD_CORE_API ExpressionParserLocation {
-  ExpressionParserLocation() : isValid(false){};
+  ExpressionParserLocation()
+      : isValid(false), startPosition(0), endPosition(0){};
   ExpressionParserLocation(size_t position)
       : isValid(true), startPosition(position), endPosition(position){};
   ExpressionParserLocation(size_t startPosition_, size_t endPosition_)
@@ -34,6 +37,18 @@ struct GD_CORE_API ExpressionParserLocation {
   size_t GetEndPosition() const { return endPosition; }
   bool IsValid() const { return isValid; }
 
+  /**
+   * \brief Return the location with its positions that are after the given
+   * one moved by the given offset (used when the expression is edited).
+   */
+  ExpressionParserLocation Shifted(size_t fromPosition,
+                                   std::ptrdiff_t offset) const {
+    if (!isValid) return *this;
+    return ExpressionParserLocation(
+        startPosition >= fromPosition ? startPosition + offset : startPosition,
+        endPosition >= fromPosition ? endPosition + offset : endPosition);
+  }
+
  private:
   bool isValid;
   size_t startPosition;
@@ -45,11 +60,23 @@ struct GD_CORE_API ExpressionParserLocation {
  */
 struct GD_CORE_API ExpressionParserDiagnostic {
   virtual ~ExpressionParserDiagnostic() = default;
+  static void *operator new(std::size_t size) {
+    return ExpressionNodeArena::AllocateNode(size);
+  }
+  static void operator delete(void *memory) noexcept {
+    ExpressionNodeArena::DeallocateNode(memory);
+  }
   virtual bool IsError() { return false; }
   virtual const gd::String &GetMessage() { return noMessage; }
   virtual size_t GetStartPosition() { return 0; }
   virtual size_t GetEndPosition() { return 0; }
 
+  /**
+   * \brief Move the positions of the diagnostic that are after the given one
+   * by the given offset (used when the expression is edited).
+   */
+  virtual void ShiftLocation(size_t fromPosition, std::ptrdiff_t offset) {}
+
  private:
   static gd::String noMessage;
 };
@@ -79,6 +106,9 @@ struct GD_CORE_API ExpressionParserError : public ExpressionParserDiagnostic {
   const gd::String &GetMessage() override { return message; }
   size_t GetStartPosition() override { return location.GetStartPosition(); }
   size_t GetEndPosition() override { return location.GetEndPosition(); }
+  void ShiftLocation(size_t fromPosition, std::ptrdiff_t offset) override {
+    location = location.Shifted(fromPosition, offset);
+  }
 
  private:
   gd::String type;
@@ -89,11 +119,20 @@ struct GD_CORE_API ExpressionParserError : public ExpressionParserDiagnostic {
 /**
  * \brief The base node, from which all nodes in the tree of
  * an expression inherits from.
+ *
+ * Nodes can be allocated from a gd::ExpressionNodeArena, which does not change
+ * how they are owned and destroyed.
  */
 struct GD_CORE_API ExpressionNode {
   ExpressionNode() : parent(nullptr) {};
   virtual ~ExpressionNode(){};
   virtual void Visit(ExpressionParser2NodeWorker &worker){};
+  static void *operator new(std::size_t size) {
+    return ExpressionNodeArena::AllocateNode(size);
+  }
+  static void operator delete(void *memory) noexcept {
+    ExpressionNodeArena::DeallocateNode(memory);
+  }
 
   std::unique_ptr<ExpressionParserDiagnostic> diagnostic;
   ExpressionParserLocation location;  ///< The location of the entire node. Some
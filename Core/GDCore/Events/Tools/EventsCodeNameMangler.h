@@ -6,6 +6,7 @@
 #if defined(GD_IDE_ONLY)
 #ifndef EVENTSCODENAMEMANGLER_H
 #define EVENTSCODENAMEMANGLER_H
+#include <mutex>
 #include <unordered_map>
 #include "GDCore/String.h"
 
@@ -21,7 +22,8 @@ class GD_CORE_API EventsCodeNameMangler {
    * A-Z or _ are replaced by "_"+AsciiCodeOfTheCharacter.
    *
    * The mangled name is memoized as this is intensively used during project
-   * export and events code generation.
+   * export and events code generation. It can be called from several
+   * threads.
    */
   const gd::String &GetMangledObjectsListName(
       const gd::String &originalObjectName);
@@ -54,6 +56,7 @@ class GD_CORE_API EventsCodeNameMangler {
   std::unordered_map<gd::String, gd::String>
       mangledExternalEventsNames;  ///< Memoized results of mangling for
                                    /// external events
+  std::mutex mangledNamesMutex;  ///< Protects the memoized results.
 };
 
 /**
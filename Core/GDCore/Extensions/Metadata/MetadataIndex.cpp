@@ -0,0 +1,124 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
+
+#include <map>
+
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/EffectMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+
+namespace {
+/**
+ * Add the metadata to the index, keeping the already indexed ones (declared
+ * by a previous extension) if any.
+ */
+template <class T>
+void AddEntries(
+    std::unordered_map<gd::String, gd::MetadataIndex::Entry<T>>& entries,
+    const gd::PlatformExtension& extension,
+    const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata) {
+    entries.emplace(it.first,
+                    gd::MetadataIndex::Entry<T>{&extension, &it.second});
+  }
+}
+
+template <class T>
+void AddEntries(
+    std::unordered_map<gd::Symbol, gd::MetadataIndex::Entry<T>>& entries,
+    const gd::PlatformExtension& extension,
+    const std::map<gd::String, T>& allMetadata) {
+  for (const auto& it : allMetadata) {
+    entries.emplace(gd::Symbol(it.first),
+                    gd::MetadataIndex::Entry<T>{&extension, &it.second});
+  }
+}
+}  // namespace
+
+namespace gd {
+
+MetadataIndex::MetadataIndex(
+    const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions) {
+  for (const auto& extensionPtr : extensions) {
+    gd::PlatformExtension& extension = *extensionPtr;
+
+    // Instructions are searched in free instructions first, then in objects
+    // and then in behaviors.
+    AddEntries(actions, extension, extension.GetAllActions());
+    AddEntries(conditions, extension, extension.GetAllConditions());
+    AddEntries(expressions, extension, extension.GetAllExpressions());
+    AddEntries(strExpressions, extension, extension.GetAllStrExpressions());
+
+    const auto objectsTypes = extension.GetExtensionObjectsTypes();
+    for (const gd::String& objectType : objectsTypes) {
+      objects.emplace(
+          objectType,
+          Entry<gd::ObjectMetadata>{&extension,
+                                    &extension.GetObjectMetadata(objectType)});
+      AddEntries(
+          actions, extension, extension.GetAllActionsForObject(objectType));
+      AddEntries(conditions,
+                 extension,
+                 extension.GetAllConditionsForObject(objectType));
+      AddEntries(objectsExpressions[objectType],
+                 extension,
+                 extension.GetAllExpressionsForObject(objectType));
+      AddEntries(objectsStrExpressions[objectType],
+                 extension,
+                 extension.GetAllStrExpressionsForObject(objectType));
+    }
+
+    const auto behaviorsTypes = extension.GetBehaviorsTypes();
+    for (const gd::String& behaviorType : behaviorsTypes) {
+      behaviors.emplace(behaviorType,
+                        Entry<gd::BehaviorMetadata>{
+                            &extension,
+                            &extension.GetBehaviorMetadata(behaviorType)});
+      AddEntries(
+          actions, extension, extension.GetAllActionsForBehavior(behaviorType));
+      AddEntries(conditions,
+                 extension,
+                 extension.GetAllConditionsForBehavior(behaviorType));
+      AddEntries(behaviorsExpressions[behaviorType],
+                 extension,
+                 extension.GetAllExpressionsForBehavior(behaviorType));
+      AddEntries(behaviorsStrExpressions[behaviorType],
+                 extension,
+                 extension.GetAllStrExpressionsForBehavior(behaviorType));
+    }
+
+    for (const gd::String& effectType : extension.GetExtensionEffectTypes()) {
+      effects.emplace(
+          effectType,
+          Entry<gd::EffectMetadata>{&extension,
+                                    &extension.GetEffectMetadata(effectType)});
+    }
+  }
+}
+
+const MetadataIndex::Entry<gd::ExpressionMetadata>*
+MetadataIndex::FindWithBaseFallback(
+    const ExpressionsByOwnerType& expressionsByOwnerType,
+    const gd::String& ownerType,
+    const gd::String& expressionType) {
+  auto ownerIt = expressionsByOwnerType.find(ownerType);
+  if (ownerIt != expressionsByOwnerType.end()) {
+    const auto* entry = Find(ownerIt->second, expressionType);
+    if (entry) return entry;
+  }
+
+  // Then check in the expressions of the base object/behavior.
+  auto baseIt = expressionsByOwnerType.find("");
+  if (baseIt == expressionsByOwnerType.end()) return nullptr;
+
+  return Find(baseIt->second, expressionType);
+}
+
+}  // namespace gd
@@ -0,0 +1,201 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#pragma once
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
+
+namespace gd {
+class BehaviorMetadata;
+class EffectMetadata;
+class ExpressionMetadata;
+class InstructionMetadata;
+class ObjectMetadata;
+class PlatformExtension;
+}  // namespace gd
+
+namespace gd {
+
+/**
+ * \brief An index of the metadata declared by the extensions of a platform,
+ * used by gd::MetadataProvider to find the metadata of an
+ * instruction, expression, object, behavior or effect from its type in O(1)
+ * instead of searching in every extension.
+ *
+ * The index is built by gd::Platform from its extensions, and is discarded
+ * when an extension is added or removed. When a type is declared by
+ * several extensions (or several objects/behaviors of an extension), the
+ * first one in the order of the extensions of the platform is kept, like a
+ * search would do.
+ *
+ * Actions and conditions are indexed by the interned symbols of their types,
+ * so that finding the metadata of a gd::Instruction (see
+ * gd::Instruction::GetTypeSymbol) only hashes and compares addresses.
+ *
+ * \note The index stores pointers to the metadata stored in the extensions:
+ * extensions must not be modified after being added to a platform.
+ *
+ * \ingroup PlatformDefinition
+ */
+class GD_CORE_API MetadataIndex {
+ public:
+  /**
+   * \brief The metadata of a type and the extension declaring it.
+   */
+  template <class T>
+  struct Entry {
+    const gd::PlatformExtension* extension;
+    const T* metadata;
+  };
+
+  /**
+   * \brief Build the index of the metadata declared by the given
+   * extensions.
+   */
+  MetadataIndex(
+      const std::vector<std::shared_ptr<gd::PlatformExtension>>& extensions);
+
+  const Entry<gd::BehaviorMetadata>* FindBehavior(
+      const gd::String& behaviorType) const {
+    return Find(behaviors, behaviorType);
+  }
+
+  const Entry<gd::ObjectMetadata>* FindObject(
+      const gd::String& objectType) const {
+    return Find(objects, objectType);
+  }
+
+  const Entry<gd::EffectMetadata>* FindEffect(
+      const gd::String& effectType) const {
+    return Find(effects, effectType);
+  }
+
+  /**
+   * \brief Find an action, being a free action or an action of an object or
+   * a behavior.
+   */
+  const Entry<gd::InstructionMetadata>* FindAction(
+      const gd::Symbol& actionType) const {
+    return Find(actions, actionType);
+  }
+
+  const Entry<gd::InstructionMetadata>* FindAction(
+      const gd::String& actionType) const {
+    return FindBySymbol(actions, actionType);
+  }
+
+  /**
+   * \brief Find a condition, being a free condition or a condition of an
+   * object or a behavior.
+   */
+  const Entry<gd::InstructionMetadata>* FindCondition(
+      const gd::Symbol& conditionType) const {
+    return Find(conditions, conditionType);
+  }
+
+  const Entry<gd::InstructionMetadata>* FindCondition(
+      const gd::String& conditionType) const {
+    return FindBySymbol(conditions, conditionType);
+  }
+
+  const Entry<gd::ExpressionMetadata>* FindExpression(
+      const gd::String& expressionType) const {
+    return Find(expressions, expressionType);
+  }
+
+  const Entry<gd::ExpressionMetadata>* FindStrExpression(
+      const gd::String& expressionType) const {
+    return Find(strExpressions, expressionType);
+  }
+
+  /**
+   * \brief Find an expression of an object, falling back to the expressions
+   * of the base object (declared for the "" object type).
+   */
+  const Entry<gd::ExpressionMetadata>* FindObjectExpression(
+      const gd::String& objectType, const gd::String& expressionType) const {
+    return FindWithBaseFallback(objectsExpressions, objectType, expressionType);
+  }
+
+  const Entry<gd::ExpressionMetadata>* FindObjectStrExpression(
+      const gd::String& objectType, const gd::String& expressionType) const {
+    return FindWithBaseFallback(
+        objectsStrExpressions, objectType, expressionType);
+  }
+
+  /**
+   * \brief Find an expression of a behavior, falling back to the expressions
+   * declared for the "" behavior type.
+   */
+  const Entry<gd::ExpressionMetadata>* FindBehaviorExpression(
+      const gd::String& behaviorType, const gd::String& expressionType) const {
+    return FindWithBaseFallback(
+        behaviorsExpressions, behaviorType, expressionType);
+  }
+
+  const Entry<gd::ExpressionMetadata>* FindBehaviorStrExpression(
+      const gd::String& behaviorType, const gd::String& expressionType) const {
+    return FindWithBaseFallback(
+        behaviorsStrExpressions, behaviorType, expressionType);
+  }
+
+ private:
+  template <class T>
+  using EntriesMap = std::unordered_map<gd::String, Entry<T>>;
+  template <class T>
+  using EntriesBySymbolMap = std::unordered_map<gd::Symbol, Entry<T>>;
+  typedef std::unordered_map<gd::String, EntriesMap<gd::ExpressionMetadata>>
+      ExpressionsByOwnerType;
+
+  template <class T>
+  static const Entry<T>* Find(const EntriesMap<T>& entries,
+                              const gd::String& type) {
+    auto it = entries.find(type);
+    return it != entries.end() ? &it->second : nullptr;
+  }
+
+  template <class T>
+  static const Entry<T>* Find(const EntriesBySymbolMap<T>& entries,
+                              const gd::Symbol& type) {
+    auto it = entries.find(type);
+    return it != entries.end() ? &it->second : nullptr;
+  }
+
+  /**
+   * \brief Find an entry from the string of its type: types that were never
+   * interned can't be in the index.
+   */
+  template <class T>
+  static const Entry<T>* FindBySymbol(const EntriesBySymbolMap<T>& entries,
+                                      const gd::String& type) {
+    gd::Symbol symbol;
+    if (!gd::Symbol::FindExisting(type, symbol)) return nullptr;
+
+    return Find(entries, symbol);
+  }
+
+  static const Entry<gd::ExpressionMetadata>* FindWithBaseFallback(
+      const ExpressionsByOwnerType& expressionsByOwnerType,
+      const gd::String& ownerType,
+      const gd::String& expressionType);
+
+  EntriesMap<gd::BehaviorMetadata> behaviors;
+  EntriesMap<gd::ObjectMetadata> objects;
+  EntriesMap<gd::EffectMetadata> effects;
+  EntriesBySymbolMap<gd::InstructionMetadata> actions;
+  EntriesBySymbolMap<gd::InstructionMetadata> conditions;
+  EntriesMap<gd::ExpressionMetadata> expressions;
+  EntriesMap<gd::ExpressionMetadata> strExpressions;
+  ExpressionsByOwnerType objectsExpressions;  ///< Indexed by object type.
+  ExpressionsByOwnerType objectsStrExpressions;
+  ExpressionsByOwnerType behaviorsExpressions;  ///< Indexed by behavior type.
+  ExpressionsByOwnerType behaviorsStrExpressions;
+};
+
+}  // namespace gd
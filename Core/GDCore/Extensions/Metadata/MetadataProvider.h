@@ -7,6 +7,7 @@
 #define METADATAPROVIDER_H
 #include "GDCore/Extensions/Metadata/InstructionMetadata.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 namespace gd {
 class BehaviorMetadata;
 class ObjectMetadata;
@@ -89,6 +90,16 @@ class GD_CORE_API MetadataProvider {
   GetExtensionAndActionMetadata(const gd::Platform& platform,
                                 gd::String actionType);
 
+  /**
+   * \copydoc GetExtensionAndActionMetadata
+   *
+   * \note Prefer this version with the symbol of the type of an instruction
+   * (see gd::Instruction::GetTypeSymbol), avoiding to hash the type.
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetExtensionAndActionMetadata(const gd::Platform& platform,
+                                const gd::Symbol& actionType);
+
   /**
    * Get the metadata of a condition, and its associated extension.
    * Works for object, behaviors and static conditions.
@@ -97,6 +108,16 @@ class GD_CORE_API MetadataProvider {
   GetExtensionAndConditionMetadata(const gd::Platform& platform,
                                    gd::String conditionType);
 
+  /**
+   * \copydoc GetExtensionAndConditionMetadata
+   *
+   * \note Prefer this version with the symbol of the type of an instruction
+   * (see gd::Instruction::GetTypeSymbol), avoiding to hash the type.
+   */
+  static ExtensionAndMetadata<InstructionMetadata>
+  GetExtensionAndConditionMetadata(const gd::Platform& platform,
+                                   const gd::Symbol& conditionType);
+
   /**
    * Get information about an expression, and its associated extension.
    * Works for free expressions.
@@ -174,6 +195,15 @@ class GD_CORE_API MetadataProvider {
   static const gd::InstructionMetadata& GetActionMetadata(
       const gd::Platform& platform, gd::String actionType);
 
+  /**
+   * \copydoc GetActionMetadata
+   *
+   * \note Prefer this version with the symbol of the type of an instruction
+   * (see gd::Instruction::GetTypeSymbol), avoiding to hash the type.
+   */
+  static const gd::InstructionMetadata& GetActionMetadata(
+      const gd::Platform& platform, const gd::Symbol& actionType);
+
   /**
    * Get the metadata of a condition.
    * Works for object, behaviors and static conditions.
@@ -181,6 +211,15 @@ class GD_CORE_API MetadataProvider {
   static const gd::InstructionMetadata& GetConditionMetadata(
       const gd::Platform& platform, gd::String conditionType);
 
+  /**
+   * \copydoc GetConditionMetadata
+   *
+   * \note Prefer this version with the symbol of the type of an instruction
+   * (see gd::Instruction::GetTypeSymbol), avoiding to hash the type.
+   */
+  static const gd::InstructionMetadata& GetConditionMetadata(
+      const gd::Platform& platform, const gd::Symbol& conditionType);
+
   /**
    * Get information about an expression from its type
    * Works for free expressions.
@@ -5,6 +5,7 @@
  */
 #include "Platform.h"
 
+#include "GDCore/Extensions/Metadata/MetadataIndex.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Object.h"
 #include "GDCore/Project/ObjectConfiguration.h"
@@ -27,16 +28,46 @@ Platform::~Platform() {}
 bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
   if (!extension) return false;
 
+  // Keep the extensions in the order they were added.
+  if (!pendingExtensions.empty()) {
+    pendingExtensions.push_back([extension]() { return extension; });
+    return true;
+  }
+
+  LoadExtension(extension);
+  return true;
+}
+
+void Platform::AddLazilyDeclaredExtension(
+    std::function<std::shared_ptr<PlatformExtension>()> declareExtension) {
+  pendingExtensions.push_back(declareExtension);
+  metadataIndex.reset();
+}
+
+void Platform::DoDeclarePendingExtensions() const {
+  // Swap the pending extensions first, as declaring them uses the platform.
+  std::vector<std::function<std::shared_ptr<PlatformExtension>()>>
+      extensionsToDeclare;
+  extensionsToDeclare.swap(pendingExtensions);
+  for (auto& declareExtension : extensionsToDeclare) {
+    std::shared_ptr<gd::PlatformExtension> extension = declareExtension();
+    if (extension) LoadExtension(extension);
+  }
+}
+
+void Platform::LoadExtension(
+    std::shared_ptr<gd::PlatformExtension> extension) const {
   if (enableExtensionLoadingLogs)
     std::cout << "Loading " << extension->GetName() << "...";
   if (IsExtensionLoaded(extension->GetName())) {
     if (enableExtensionLoadingLogs)
       std::cout << " (replacing existing extension)";
-    RemoveExtension(extension->GetName());
+    UnloadExtension(extension->GetName());
   }
   if (enableExtensionLoadingLogs) std::cout << std::endl;
 
   extensionsLoaded.push_back(extension);
+  metadataIndex.reset();
 
   // Load all creation/destruction functions for objects provided by the
   // extension
@@ -50,11 +81,14 @@ bool Platform::AddExtension(std::shared_ptr<gd::PlatformExtension> extension) {
        extension->GetAllInstructionOrExpressionGroupMetadata()) {
     instructionOrExpressionGroupMetadata[it.first] = it.second;
   }
-
-  return true;
 }
 
 void Platform::RemoveExtension(const gd::String& name) {
+  DeclarePendingExtensions();
+  UnloadExtension(name);
+}
+
+void Platform::UnloadExtension(const gd::String& name) const {
   // Unload all creation/destruction functions for objects provided by the
   // extension
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
@@ -74,9 +108,11 @@ void Platform::RemoveExtension(const gd::String& name) {
                   return extension->GetName() == name;
                 }),
       extensionsLoaded.end());
+  metadataIndex.reset();
 }
 
 bool Platform::IsExtensionLoaded(const gd::String& name) const {
+  DeclarePendingExtensions();
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return true;
   }
@@ -86,6 +122,7 @@ bool Platform::IsExtensionLoaded(const gd::String& name) const {
 
 std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
     const gd::String& name) const {
+  DeclarePendingExtensions();
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     if (extensionsLoaded[i]->GetName() == name) return extensionsLoaded[i];
   }
@@ -93,8 +130,17 @@ std::shared_ptr<gd::PlatformExtension> Platform::GetExtension(
   return std::shared_ptr<gd::PlatformExtension>();
 }
 
+const gd::MetadataIndex& Platform::GetMetadataIndex() const {
+  DeclarePendingExtensions();
+  if (!metadataIndex)
+    metadataIndex = std::make_shared<gd::MetadataIndex>(extensionsLoaded);
+
+  return *metadataIndex;
+}
+
 std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
     gd::String type) const {
+  DeclarePendingExtensions();
   if (creationFunctionTable.find(type) == creationFunctionTable.end()) {
     gd::LogWarning("Tried to create an object with an unknown type: " + type
               + " for platform " + GetName() + "!");
@@ -114,6 +160,7 @@ std::unique_ptr<gd::ObjectConfiguration> Platform::CreateObjectConfiguration(
 #if defined(GD_IDE_ONLY)
 std::shared_ptr<gd::BaseEvent> Platform::CreateEvent(
     const gd::String& eventType) const {
+  DeclarePendingExtensions();
   for (std::size_t i = 0; i < extensionsLoaded.size(); ++i) {
     std::shared_ptr<gd::BaseEvent> event =
         extensionsLoaded[i]->CreateEvent(eventType);
@@ -6,6 +6,7 @@
 
 #ifndef GDCORE_PLATFORM_H
 #define GDCORE_PLATFORM_H
+#include <functional>
 #include <map>
 #include <memory>
 #include <vector>
@@ -24,6 +25,7 @@ class BaseEvent;
 class BehaviorsSharedData;
 class PlatformExtension;
 class LayoutEditorCanvas;
+class MetadataIndex;
 class ProjectExporter;
 }  // namespace gd
 
@@ -93,9 +95,28 @@ class GD_CORE_API Platform {
    * \brief Add an extension to the platform.
    * \note This method is virtual and can be redefined by platforms if they want
    * to do special work when an extension is loaded. \see gd::ExtensionsLoader
+   * \warning The extension must be fully declared: it must not be modified
+   * after being added.
    */
   virtual bool AddExtension(std::shared_ptr<PlatformExtension> extension);
 
+  /**
+   * \brief Add an extension to the platform, declaring it only when the
+   * extensions of the platform are used for the first time.
+   *
+   * This allows to create a platform without paying the cost of declaring all
+   * its extensions (and their thousands of metadata) until they are needed.
+   * The extensions are declared, in the order they were added, by any member
+   * function giving access to extensions, metadata or creating objects and
+   * events.
+   *
+   * \note As with gd::Platform::GetMetadataIndex, use the platform once before
+   * using it from several threads, so that extensions are not declared
+   * concurrently.
+   */
+  void AddLazilyDeclaredExtension(
+      std::function<std::shared_ptr<PlatformExtension>()> declareExtension);
+
   /**
    * \brief Return true if an extension with the specified name is loaded
    */
@@ -113,6 +134,7 @@ class GD_CORE_API Platform {
    */
   const std::vector<std::shared_ptr<gd::PlatformExtension>>&
   GetAllPlatformExtensions() const {
+    DeclarePendingExtensions();
     return extensionsLoaded;
   };
 
@@ -130,12 +152,27 @@ class GD_CORE_API Platform {
    */
   const InstructionOrExpressionGroupMetadata& GetInstructionOrExpressionGroupMetadata(
       const gd::String& name) const {
+    DeclarePendingExtensions();
     auto it = instructionOrExpressionGroupMetadata.find(name);
     if (it == instructionOrExpressionGroupMetadata.end())
       return badInstructionOrExpressionGroupMetadata;
 
     return it->second;
   }
+
+  /**
+   * \brief Get the index of the metadata declared by the extensions, to find
+   * metadata by type without searching in every extension.
+   *
+   * The index is built on first use and discarded when an extension is added
+   * or removed.
+   *
+   * \warning Call it once before searching metadata from several threads, so
+   * that the index is not built concurrently.
+   *
+   * \see gd::MetadataProvider
+   */
+  const gd::MetadataIndex& GetMetadataIndex() const;
   ///@}
 
   /** \name Factory method
@@ -166,13 +203,39 @@ class GD_CORE_API Platform {
   };
 
  private:
-  std::vector<std::shared_ptr<PlatformExtension>>
+  /**
+   * \brief Declare the extensions added with AddLazilyDeclaredExtension that
+   * were not declared yet.
+   */
+  void DeclarePendingExtensions() const {
+    if (!pendingExtensions.empty()) DoDeclarePendingExtensions();
+  };
+  void DoDeclarePendingExtensions() const;
+
+  /**
+   * \brief Add an extension which is declared.
+   */
+  void LoadExtension(std::shared_ptr<PlatformExtension> extension) const;
+
+  /**
+   * \brief Remove a declared extension.
+   */
+  void UnloadExtension(const gd::String& name) const;
+
+  // Members are mutable as they are filled when pending extensions are
+  // declared, on first use.
+  mutable std::vector<std::shared_ptr<PlatformExtension>>
       extensionsLoaded;  ///< Extensions of the platform
-  std::map<gd::String, CreateFunPtr>
+  mutable std::vector<std::function<std::shared_ptr<PlatformExtension>()>>
+      pendingExtensions;  ///< Extensions to be declared on first use.
+  mutable std::map<gd::String, CreateFunPtr>
       creationFunctionTable;  ///< Creation functions for objects
-  std::map<gd::String, InstructionOrExpressionGroupMetadata>
+  mutable std::map<gd::String, InstructionOrExpressionGroupMetadata>
       instructionOrExpressionGroupMetadata;
   static InstructionOrExpressionGroupMetadata badInstructionOrExpressionGroupMetadata;
+  mutable std::shared_ptr<const gd::MetadataIndex>
+      metadataIndex;  ///< Built on first use, null when outdated. Shared by
+                      ///< copies, which have the same extensions.
   bool enableExtensionLoadingLogs;
 };
 
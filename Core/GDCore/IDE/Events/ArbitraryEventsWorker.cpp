@@ -21,6 +21,15 @@ namespace gd {
 
 ArbitraryEventsWorker::~ArbitraryEventsWorker() {}
 
+void ArbitraryEventsWorker::Launch(gd::EventsList& events) {
+  if (!ShouldVisitEventsList(events)) return;
+
+  VisitEventList(events);
+
+  // The worker may have modified the events.
+  if (events.HasSymbolsIndex()) events.IndexSymbols();
+}
+
 void ArbitraryEventsWorker::VisitEventList(gd::EventsList& events) {
   DoVisitEventList(events);
 
@@ -20,6 +20,9 @@ class EventsList;
 class ObjectsContainer;
 class Expression;
 class ParameterMetadata;
+class ArbitraryEventsWorkersGroup;
+class ArbitraryEventsWorkersGroupWithContext;
+class ReadOnlyArbitraryEventsWorkersGroupWithContext;
 }  // namespace gd
 
 namespace gd {
@@ -40,10 +43,16 @@ class GD_CORE_API ArbitraryEventsWorker : private EventVisitor {
 
   /**
    * \brief Launch the worker on the specified events list.
+   *
+   * If the symbols used by the events list are indexed, the index is updated
+   * after the worker is done (see gd::EventsList::IndexSymbols).
    */
-  void Launch(gd::EventsList& events) { VisitEventList(events); };
+  void Launch(gd::EventsList& events);
 
  private:
+  friend class ArbitraryEventsWorkersGroup;
+  friend class ArbitraryEventsWorkersGroupWithContext;
+
   void VisitEventList(gd::EventsList& events);
   bool VisitEvent(gd::BaseEvent& event) override;
   bool VisitLinkEvent(gd::LinkEvent& linkEvent) override;
@@ -52,6 +61,14 @@ class GD_CORE_API ArbitraryEventsWorker : private EventVisitor {
   bool VisitInstruction(gd::Instruction& instruction, bool isCondition);
   bool VisitEventExpression(gd::Expression& expression, const gd::ParameterMetadata& metadata);
 
+  /**
+   * Called with the events list given to Launch, before visiting it.
+   * \return false if the events list can be skipped, for example because
+   * its symbols index tells that it can't use the renamed element (see
+   * gd::EventsList::MayUseSymbol), true otherwise (default).
+   */
+  virtual bool ShouldVisitEventsList(gd::EventsList& events) { return true; };
+
   /**
    * Called to do some work on an event list.
    */
@@ -141,6 +158,8 @@ class GD_CORE_API ArbitraryEventsWorkerWithContext
   };
 
  private:
+  friend class ArbitraryEventsWorkersGroupWithContext;
+
   const gd::ProjectScopedContainers* projectScopedContainers;
 };
 
@@ -166,6 +185,8 @@ protected:
   void StopAnyEventIteration() override;
 
  private:
+  friend class ReadOnlyArbitraryEventsWorkersGroupWithContext;
+
   void VisitEventList(const gd::EventsList& events);
   void VisitEvent(const gd::BaseEvent& event) override;
   void VisitLinkEvent(const gd::LinkEvent& linkEvent) override;
@@ -248,6 +269,8 @@ class GD_CORE_API ReadOnlyArbitraryEventsWorkerWithContext
   };
 
  private:
+  friend class ReadOnlyArbitraryEventsWorkersGroupWithContext;
+
   const gd::ProjectScopedContainers* projectScopedContainers;
 };
 
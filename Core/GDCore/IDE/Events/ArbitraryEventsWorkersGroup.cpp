@@ -0,0 +1,180 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersGroup.h"
+
+#include <vector>
+
+#include "GDCore/Events/EventsList.h"
+
+namespace gd {
+
+ArbitraryEventsWorkersGroup::~ArbitraryEventsWorkersGroup() {}
+
+bool ArbitraryEventsWorkersGroup::ShouldVisitEventsList(
+    gd::EventsList& events) {
+  launchedWorkers.clear();
+  for (auto* worker : workers) {
+    if (worker->ShouldVisitEventsList(events))
+      launchedWorkers.push_back(worker);
+  }
+
+  return !launchedWorkers.empty();
+}
+
+void ArbitraryEventsWorkersGroup::DoVisitEventList(gd::EventsList& events) {
+  for (auto* worker : launchedWorkers) worker->DoVisitEventList(events);
+}
+
+bool ArbitraryEventsWorkersGroup::DoVisitEvent(gd::BaseEvent& event) {
+  for (auto* worker : launchedWorkers) {
+    if (worker->DoVisitEvent(event)) return true;
+  }
+  return false;
+}
+
+bool ArbitraryEventsWorkersGroup::DoVisitLinkEvent(gd::LinkEvent& linkEvent) {
+  for (auto* worker : launchedWorkers) {
+    if (worker->DoVisitLinkEvent(linkEvent)) return true;
+  }
+  return false;
+}
+
+void ArbitraryEventsWorkersGroup::DoVisitInstructionList(
+    gd::InstructionsList& instructions, bool areConditions) {
+  for (auto* worker : launchedWorkers)
+    worker->DoVisitInstructionList(instructions, areConditions);
+}
+
+bool ArbitraryEventsWorkersGroup::DoVisitInstruction(
+    gd::Instruction& instruction, bool isCondition) {
+  for (auto* worker : launchedWorkers) {
+    if (worker->DoVisitInstruction(instruction, isCondition)) return true;
+  }
+  return false;
+}
+
+bool ArbitraryEventsWorkersGroup::DoVisitEventExpression(
+    gd::Expression& expression, const gd::ParameterMetadata& metadata) {
+  for (auto* worker : launchedWorkers) {
+    if (worker->DoVisitEventExpression(expression, metadata)) return true;
+  }
+  return false;
+}
+
+ArbitraryEventsWorkersGroupWithContext::
+    ~ArbitraryEventsWorkersGroupWithContext() {}
+
+bool ArbitraryEventsWorkersGroupWithContext::ShouldVisitEventsList(
+    gd::EventsList& events) {
+  for (auto* worker : workersWithContext)
+    worker->projectScopedContainers = &GetProjectScopedContainers();
+
+  return static_cast<ArbitraryEventsWorker&>(group).ShouldVisitEventsList(
+      events);
+}
+
+void ArbitraryEventsWorkersGroupWithContext::DoVisitEventList(
+    gd::EventsList& events) {
+  static_cast<ArbitraryEventsWorker&>(group).DoVisitEventList(events);
+}
+
+bool ArbitraryEventsWorkersGroupWithContext::DoVisitEvent(
+    gd::BaseEvent& event) {
+  return static_cast<ArbitraryEventsWorker&>(group).DoVisitEvent(event);
+}
+
+bool ArbitraryEventsWorkersGroupWithContext::DoVisitLinkEvent(
+    gd::LinkEvent& linkEvent) {
+  return static_cast<ArbitraryEventsWorker&>(group).DoVisitLinkEvent(
+      linkEvent);
+}
+
+void ArbitraryEventsWorkersGroupWithContext::DoVisitInstructionList(
+    gd::InstructionsList& instructions, bool areConditions) {
+  static_cast<ArbitraryEventsWorker&>(group).DoVisitInstructionList(
+      instructions, areConditions);
+}
+
+bool ArbitraryEventsWorkersGroupWithContext::DoVisitInstruction(
+    gd::Instruction& instruction, bool isCondition) {
+  return static_cast<ArbitraryEventsWorker&>(group).DoVisitInstruction(
+      instruction, isCondition);
+}
+
+bool ArbitraryEventsWorkersGroupWithContext::DoVisitEventExpression(
+    gd::Expression& expression, const gd::ParameterMetadata& metadata) {
+  return static_cast<ArbitraryEventsWorker&>(group).DoVisitEventExpression(
+      expression, metadata);
+}
+
+ReadOnlyArbitraryEventsWorkersGroupWithContext::
+    ~ReadOnlyArbitraryEventsWorkersGroupWithContext() {}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::DoVisitEventList(
+    const gd::EventsList& events) {
+  // The context is given again for each events list, as the group can be
+  // launched on other events (with another context) between them.
+  for (auto* worker : workersWithContext)
+    worker->projectScopedContainers = &GetProjectScopedContainers();
+
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration) worker->DoVisitEventList(events);
+  }
+  StopIterationIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::DoVisitEvent(
+    const gd::BaseEvent& event) {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration) worker->DoVisitEvent(event);
+  }
+  StopIterationIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::DoVisitLinkEvent(
+    const gd::LinkEvent& linkEvent) {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration) worker->DoVisitLinkEvent(linkEvent);
+  }
+  StopIterationIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::DoVisitInstructionList(
+    const gd::InstructionsList& instructions, bool areConditions) {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration)
+      worker->DoVisitInstructionList(instructions, areConditions);
+  }
+  StopIterationIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::DoVisitInstruction(
+    const gd::Instruction& instruction, bool isCondition) {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration)
+      worker->DoVisitInstruction(instruction, isCondition);
+  }
+  StopIterationIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::DoVisitEventExpression(
+    const gd::Expression& expression, const gd::ParameterMetadata& metadata) {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration)
+      worker->DoVisitEventExpression(expression, metadata);
+  }
+  StopIterationIfAllWorkersStopped();
+}
+
+void ReadOnlyArbitraryEventsWorkersGroupWithContext::
+    StopIterationIfAllWorkersStopped() {
+  for (auto* worker : workers) {
+    if (!worker->shouldStopIteration) return;
+  }
+  StopAnyEventIteration();
+}
+
+}  // namespace gd
@@ -0,0 +1,191 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#ifndef GDCORE_ARBITRARYEVENTSWORKERSGROUP_H
+#define GDCORE_ARBITRARYEVENTSWORKERSGROUP_H
+#include <vector>
+
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+
+namespace gd {
+
+/**
+ * \brief Launch several workers in a single traversal of the events.
+ *
+ * Each events list, event, instruction and expression is given to the
+ * workers one after the other, in the order they were added. This gives the
+ * same result as launching the workers one after the other, as long as the
+ * changes made by a worker on an event (or an instruction) don't matter to
+ * the other workers for the other events. When a worker asks for an event or
+ * an instruction to be deleted, the next workers are not called with it.
+ *
+ * Expressions are parsed once for all the workers, as their tree is kept by
+ * gd::Expression.
+ *
+ * \note The workers must outlive the group.
+ *
+ * \see gd::ArbitraryEventsWorkersGroupWithContext
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ArbitraryEventsWorkersGroup : public ArbitraryEventsWorker {
+ public:
+  ArbitraryEventsWorkersGroup(){};
+  virtual ~ArbitraryEventsWorkersGroup();
+
+  /**
+   * \brief Add a worker to launch with the others.
+   */
+  ArbitraryEventsWorkersGroup& AddWorker(gd::ArbitraryEventsWorker& worker) {
+    workers.push_back(&worker);
+    return *this;
+  };
+
+  /**
+   * \brief Return the number of workers of the group.
+   */
+  std::size_t GetWorkersCount() const { return workers.size(); };
+
+ private:
+  bool ShouldVisitEventsList(gd::EventsList& events) override;
+  void DoVisitEventList(gd::EventsList& events) override;
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitLinkEvent(gd::LinkEvent& linkEvent) override;
+  void DoVisitInstructionList(gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+  bool DoVisitEventExpression(gd::Expression& expression,
+                              const gd::ParameterMetadata& metadata) override;
+
+  std::vector<gd::ArbitraryEventsWorker*> workers;
+  std::vector<gd::ArbitraryEventsWorker*>
+      launchedWorkers;  ///< The workers visiting the current events list.
+};
+
+/**
+ * \brief Launch several workers, with or without context, in a single
+ * traversal of the events.
+ *
+ * \see gd::ArbitraryEventsWorkersGroup
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ArbitraryEventsWorkersGroupWithContext
+    : public ArbitraryEventsWorkerWithContext {
+ public:
+  ArbitraryEventsWorkersGroupWithContext(){};
+  virtual ~ArbitraryEventsWorkersGroupWithContext();
+
+  /**
+   * \brief Add a worker to launch with the others.
+   */
+  ArbitraryEventsWorkersGroupWithContext& AddWorker(
+      gd::ArbitraryEventsWorker& worker) {
+    group.AddWorker(worker);
+    return *this;
+  };
+
+  /**
+   * \brief Add a worker to launch with the others, giving it the context of
+   * the group.
+   */
+  ArbitraryEventsWorkersGroupWithContext& AddWorker(
+      gd::ArbitraryEventsWorkerWithContext& worker) {
+    group.AddWorker(worker);
+    workersWithContext.push_back(&worker);
+    return *this;
+  };
+
+  /**
+   * \brief Return the number of workers of the group.
+   */
+  std::size_t GetWorkersCount() const { return group.GetWorkersCount(); };
+
+ private:
+  bool ShouldVisitEventsList(gd::EventsList& events) override;
+  void DoVisitEventList(gd::EventsList& events) override;
+  bool DoVisitEvent(gd::BaseEvent& event) override;
+  bool DoVisitLinkEvent(gd::LinkEvent& linkEvent) override;
+  void DoVisitInstructionList(gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  bool DoVisitInstruction(gd::Instruction& instruction,
+                          bool isCondition) override;
+  bool DoVisitEventExpression(gd::Expression& expression,
+                              const gd::ParameterMetadata& metadata) override;
+
+  ArbitraryEventsWorkersGroup group;
+  std::vector<gd::ArbitraryEventsWorkerWithContext*> workersWithContext;
+};
+
+/**
+ * \brief Launch several read-only workers, with or without context, in a
+ * single traversal of the events.
+ *
+ * A worker stopping the iteration (see
+ * ReadOnlyArbitraryEventsWorker::StopAnyEventIteration) is not called
+ * anymore, while the others go on.
+ *
+ * \note The workers must outlive the group.
+ *
+ * \see gd::ArbitraryEventsWorkersGroup
+ *
+ * \ingroup IDE
+ */
+class GD_CORE_API ReadOnlyArbitraryEventsWorkersGroupWithContext
+    : public ReadOnlyArbitraryEventsWorkerWithContext {
+ public:
+  ReadOnlyArbitraryEventsWorkersGroupWithContext(){};
+  virtual ~ReadOnlyArbitraryEventsWorkersGroupWithContext();
+
+  /**
+   * \brief Add a worker to launch with the others.
+   */
+  ReadOnlyArbitraryEventsWorkersGroupWithContext& AddWorker(
+      gd::ReadOnlyArbitraryEventsWorker& worker) {
+    workers.push_back(&worker);
+    return *this;
+  };
+
+  /**
+   * \brief Add a worker to launch with the others, giving it the context of
+   * the group.
+   */
+  ReadOnlyArbitraryEventsWorkersGroupWithContext& AddWorker(
+      gd::ReadOnlyArbitraryEventsWorkerWithContext& worker) {
+    workers.push_back(&worker);
+    workersWithContext.push_back(&worker);
+    return *this;
+  };
+
+  /**
+   * \brief Return the number of workers of the group.
+   */
+  std::size_t GetWorkersCount() const { return workers.size(); };
+
+ private:
+  void DoVisitEventList(const gd::EventsList& events) override;
+  void DoVisitEvent(const gd::BaseEvent& event) override;
+  void DoVisitLinkEvent(const gd::LinkEvent& linkEvent) override;
+  void DoVisitInstructionList(const gd::InstructionsList& instructions,
+                              bool areConditions) override;
+  void DoVisitInstruction(const gd::Instruction& instruction,
+                          bool isCondition) override;
+  void DoVisitEventExpression(const gd::Expression& expression,
+                              const gd::ParameterMetadata& metadata) override;
+
+  /**
+   * Stop the iteration when all the workers stopped it.
+   */
+  void StopIterationIfAllWorkersStopped();
+
+  std::vector<gd::ReadOnlyArbitraryEventsWorker*> workers;
+  std::vector<gd::ReadOnlyArbitraryEventsWorkerWithContext*>
+      workersWithContext;
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_ARBITRARYEVENTSWORKERSGROUP_H
@@ -103,9 +103,9 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                                bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
       instruction.GetParameters(),
@@ -124,7 +124,7 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
             }
           }
         } else {
-          auto node = parameterValue.GetRootNode();
+          auto node = parameterValue.ParseModifiableRootNode();
           if (node) {
             ExpressionBehaviorRenamer renamer(objectName,
                                               oldBehaviorName,
@@ -143,6 +143,10 @@ bool EventsBehaviorRenamer::DoVisitInstruction(gd::Instruction& instruction,
   return false;
 }
 
+bool EventsBehaviorRenamer::ShouldVisitEventsList(gd::EventsList &events) {
+  return events.MayUseSymbol(oldBehaviorName);
+}
+
 EventsBehaviorRenamer::~EventsBehaviorRenamer() {}
 
 }  // namespace gd
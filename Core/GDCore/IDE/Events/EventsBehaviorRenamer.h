@@ -38,6 +38,7 @@ class GD_CORE_API EventsBehaviorRenamer : public ArbitraryEventsWorkerWithContex
   virtual ~EventsBehaviorRenamer();
 
  private:
+  bool ShouldVisitEventsList(gd::EventsList &events) override;
   bool DoVisitInstruction(gd::Instruction &instruction,
                           bool isCondition) override;
 
@@ -204,9 +204,9 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
   bool shouldDeleteInstruction = false;
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
@@ -223,7 +223,7 @@ bool EventsPropertyReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain properties.
 
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.ParseModifiableRootNode();
         if (node) {
           ExpressionPropertyReplacer renamer(platform,
                                              GetProjectScopedContainers(),
@@ -253,7 +253,7 @@ bool EventsPropertyReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain properties.
 
-  auto node = expression.GetRootNode();
+  auto node = expression.ParseModifiableRootNode();
   if (node) {
     ExpressionPropertyReplacer renamer(platform,
                                        GetProjectScopedContainers(),
@@ -304,7 +304,8 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
 
   for (std::size_t aId = 0; aId < actions.size(); ++aId) {
     const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
+        MetadataProvider::GetActionMetadata(
+            platform, actions[aId].GetTypeSymbol());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
       // Replace object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
@@ -313,7 +314,7 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
       // Replace object's name in expressions
       else if (ParameterMetadata::IsExpression(
                    "number", instrInfos.parameters[pNb].GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
+        auto node = actions[aId].GetParameter(pNb).ParseModifiableRootNode();
 
         if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldName, newName)) {
           actions[aId].SetParameter(
@@ -323,7 +324,7 @@ bool EventsRefactorer::RenameObjectInActions(const gd::Platform& platform,
       // Replace object's name in text expressions
       else if (ParameterMetadata::IsExpression(
                    "string", instrInfos.parameters[pNb].GetType())) {
-        auto node = actions[aId].GetParameter(pNb).GetRootNode();
+        auto node = actions[aId].GetParameter(pNb).ParseModifiableRootNode();
 
         if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldName, newName)) {
           actions[aId].SetParameter(
@@ -356,7 +357,7 @@ bool EventsRefactorer::RenameObjectInConditions(
   for (std::size_t cId = 0; cId < conditions.size(); ++cId) {
     const gd::InstructionMetadata& instrInfos =
         MetadataProvider::GetConditionMetadata(platform,
-                                               conditions[cId].GetType());
+                                               conditions[cId].GetTypeSymbol());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
       // Replace object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
@@ -365,7 +366,7 @@ bool EventsRefactorer::RenameObjectInConditions(
       // Replace object's name in expressions
       else if (ParameterMetadata::IsExpression(
                    "number", instrInfos.parameters[pNb].GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
+        auto node = conditions[cId].GetParameter(pNb).ParseModifiableRootNode();
 
         if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldName, newName)) {
           conditions[cId].SetParameter(
@@ -375,7 +376,7 @@ bool EventsRefactorer::RenameObjectInConditions(
       // Replace object's name in text expressions
       else if (ParameterMetadata::IsExpression(
                    "string", instrInfos.parameters[pNb].GetType())) {
-        auto node = conditions[cId].GetParameter(pNb).GetRootNode();
+        auto node = conditions[cId].GetParameter(pNb).ParseModifiableRootNode();
 
         if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldName, newName)) {
           conditions[cId].SetParameter(
@@ -412,7 +413,7 @@ bool EventsRefactorer::RenameObjectInEventParameters(
   // Replace object's name in expressions
   else if (ParameterMetadata::IsExpression("number",
                                            parameterMetadata.GetType())) {
-    auto node = expression.GetRootNode();
+    auto node = expression.ParseModifiableRootNode();
 
     if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "number", *node, oldName, newName)) {
       expression = ExpressionParser2NodePrinter::PrintNode(*node);
@@ -421,7 +422,7 @@ bool EventsRefactorer::RenameObjectInEventParameters(
   // Replace object's name in text expressions
   else if (ParameterMetadata::IsExpression("string",
                                            parameterMetadata.GetType())) {
-    auto node = expression.GetRootNode();
+    auto node = expression.ParseModifiableRootNode();
 
     if (ExpressionObjectRenamer::Rename(platform, projectScopedContainers, "string", *node, oldName, newName)) {
       expression = ExpressionParser2NodePrinter::PrintNode(*node);
@@ -436,6 +437,8 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                                             gd::EventsList& events,
                                             gd::String oldName,
                                             gd::String newName) {
+  if (!events.MayUseSymbol(oldName)) return;
+
   for (std::size_t i = 0; i < events.size(); ++i) {
     vector<gd::InstructionsList*> conditionsVectors =
         events[i].GetAllConditionsVectors();
@@ -472,6 +475,8 @@ void EventsRefactorer::RenameObjectInEvents(const gd::Platform& platform,
                            oldName,
                            newName);
   }
+
+  if (events.HasSymbolsIndex()) events.IndexSymbols();
 }
 
 bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
@@ -484,7 +489,8 @@ bool EventsRefactorer::RemoveObjectInActions(const gd::Platform& platform,
     bool deleteMe = false;
 
     const gd::InstructionMetadata& instrInfos =
-        MetadataProvider::GetActionMetadata(platform, actions[aId].GetType());
+        MetadataProvider::GetActionMetadata(
+            platform, actions[aId].GetTypeSymbol());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
       // Find object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
@@ -542,7 +548,7 @@ bool EventsRefactorer::RemoveObjectInConditions(
 
     const gd::InstructionMetadata& instrInfos =
         MetadataProvider::GetConditionMetadata(platform,
-                                               conditions[cId].GetType());
+                                               conditions[cId].GetTypeSymbol());
     for (std::size_t pNb = 0; pNb < instrInfos.parameters.size(); ++pNb) {
       // Find object's name in parameters
       if (gd::ParameterMetadata::IsObject(instrInfos.parameters[pNb].GetType()) &&
@@ -592,6 +598,10 @@ void EventsRefactorer::RemoveObjectInEvents(const gd::Platform& platform,
                                             gd::ProjectScopedContainers& projectScopedContainers,
                                             gd::EventsList& events,
                                             gd::String name) {
+  // Removing instructions can't add symbols to the events, so their index
+  // (if any) stays valid.
+  if (!events.MayUseSymbol(name)) return;
+
   for (std::size_t i = 0; i < events.size(); ++i) {
     vector<gd::InstructionsList*> conditionsVectors =
         events[i].GetAllConditionsVectors();
@@ -998,9 +1008,9 @@ bool EventsRefactorer::SearchStringInFormattedText(const gd::Platform& platform,
                                                    bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
   gd::String completeSentence =
       gd::InstructionSentenceFormatter::Get()->GetFullText(instruction,
                                                            metadata);
@@ -327,9 +327,9 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
                                                 bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
   bool shouldDeleteInstruction = false;
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
@@ -346,7 +346,7 @@ bool EventsVariableReplacer::DoVisitInstruction(gd::Instruction& instruction,
             !gd::ParameterMetadata::IsExpression("string", type))
           return;  // Not an expression that can contain variables.
 
-        auto node = parameterValue.GetRootNode();
+        auto node = parameterValue.ParseModifiableRootNode();
         if (node) {
           ExpressionVariableReplacer renamer(platform,
                                              GetProjectScopedContainers(),
@@ -378,7 +378,7 @@ bool EventsVariableReplacer::DoVisitEventExpression(
       !gd::ParameterMetadata::IsExpression("string", type))
     return false;  // Not an expression that can contain variables.
 
-  auto node = expression.GetRootNode();
+  auto node = expression.ParseModifiableRootNode();
   if (node) {
     ExpressionVariableReplacer renamer(platform,
                                        GetProjectScopedContainers(),
@@ -399,6 +399,16 @@ bool EventsVariableReplacer::DoVisitEventExpression(
   return false;
 }
 
+bool EventsVariableReplacer::ShouldVisitEventsList(gd::EventsList &events) {
+  for (const auto &oldToNewVariableName : oldToNewVariableNames) {
+    if (events.MayUseSymbol(oldToNewVariableName.first)) return true;
+  }
+  for (const auto &removedVariableName : removedVariableNames) {
+    if (events.MayUseSymbol(removedVariableName)) return true;
+  }
+  return false;
+}
+
 EventsVariableReplacer::~EventsVariableReplacer() {}
 
 }  // namespace gd
@@ -42,6 +42,7 @@ class GD_CORE_API EventsVariableReplacer
   virtual ~EventsVariableReplacer();
 
  private:
+  bool ShouldVisitEventsList(gd::EventsList &events) override;
   bool DoVisitInstruction(gd::Instruction &instruction,
                           bool isCondition) override;
   bool DoVisitEventExpression(gd::Expression &expression,
@@ -147,16 +147,16 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
                                             bool isCondition) {
   const auto& metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   for (std::size_t pNb = 0; pNb < metadata.parameters.size() &&
                             pNb < instruction.GetParametersCount();
        ++pNb) {
     const gd::Expression& expression = instruction.GetParameter(pNb);
 
-    auto node = expression.GetRootNode();
+    auto node = expression.ParseModifiableRootNode();
     if (node) {
       ExpressionFunctionRenamer renamer(GetProjectScopedContainers(),
                                         behaviorType,
@@ -175,6 +175,10 @@ bool ExpressionsRenamer::DoVisitInstruction(gd::Instruction& instruction,
   return false;
 }
 
+bool ExpressionsRenamer::ShouldVisitEventsList(gd::EventsList &events) {
+  return events.MayUseSymbol(oldFunctionName);
+}
+
 ExpressionsRenamer::~ExpressionsRenamer() {}
 
 }  // namespace gd
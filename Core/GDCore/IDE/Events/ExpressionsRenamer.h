@@ -59,6 +59,7 @@ class GD_CORE_API ExpressionsRenamer : public ArbitraryEventsWorkerWithContext {
   };
 
  private:
+  bool ShouldVisitEventsList(gd::EventsList &events) override;
   bool DoVisitInstruction(gd::Instruction &instruction,
                           bool isCondition) override;
 
@@ -24,6 +24,10 @@ bool InstructionsTypeRenamer::DoVisitInstruction(gd::Instruction& instruction,
   return false;
 }
 
+bool InstructionsTypeRenamer::ShouldVisitEventsList(gd::EventsList& events) {
+  return events.MayUseSymbol(oldType);
+}
+
 InstructionsTypeRenamer::~InstructionsTypeRenamer() {}
 
 }  // namespace gd
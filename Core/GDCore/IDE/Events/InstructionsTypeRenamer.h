@@ -33,6 +33,7 @@ class GD_CORE_API InstructionsTypeRenamer : public ArbitraryEventsWorker {
   virtual ~InstructionsTypeRenamer();
 
  private:
+  bool ShouldVisitEventsList(gd::EventsList& events) override;
   bool DoVisitInstruction(gd::Instruction& instruction,
                           bool isCondition) override;
 
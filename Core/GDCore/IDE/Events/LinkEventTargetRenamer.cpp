@@ -28,6 +28,10 @@ bool LinkEventTargetRenamer::DoVisitLinkEvent(gd::LinkEvent &linkEvent) {
   return false;
 }
 
+bool LinkEventTargetRenamer::ShouldVisitEventsList(gd::EventsList &events) {
+  return events.MayUseSymbol(oldName);
+}
+
 LinkEventTargetRenamer::~LinkEventTargetRenamer() {}
 
 } // namespace gd
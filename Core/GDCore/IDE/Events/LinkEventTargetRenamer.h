@@ -34,6 +34,7 @@ public:
   virtual ~LinkEventTargetRenamer();
 
 private:
+  bool ShouldVisitEventsList(gd::EventsList &events) override;
   bool DoVisitLinkEvent(gd::LinkEvent &linkEvent) override;
 
   const gd::Platform &platform;
@@ -141,9 +141,9 @@ bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
                                                bool isCondition) {
   const auto &metadata = isCondition
                              ? gd::MetadataProvider::GetConditionMetadata(
-                                   platform, instruction.GetType())
+                                   platform, instruction.GetTypeSymbol())
                              : gd::MetadataProvider::GetActionMetadata(
-                                   platform, instruction.GetType());
+                                   platform, instruction.GetTypeSymbol());
 
   gd::String lastLayerName;
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
@@ -207,6 +207,10 @@ bool ProjectElementRenamer::DoVisitInstruction(gd::Instruction &instruction,
   return false;
 }
 
+bool ProjectElementRenamer::ShouldVisitEventsList(gd::EventsList &events) {
+  return events.MayUseSymbol(oldName);
+}
+
 ProjectElementRenamer::~ProjectElementRenamer() {}
 
 } // namespace gd
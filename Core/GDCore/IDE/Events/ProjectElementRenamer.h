@@ -45,6 +45,7 @@ public:
   }
 
 private:
+  bool ShouldVisitEventsList(gd::EventsList &events) override;
   bool DoVisitInstruction(gd::Instruction &instruction,
                           bool isCondition) override;
 
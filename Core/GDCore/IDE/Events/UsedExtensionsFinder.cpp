@@ -1,5 +1,7 @@
 #include "UsedExtensionsFinder.h"
 
+#include <memory>
+
 #include "GDCore/Events/Instruction.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Metadata/ParameterMetadataTools.h"
@@ -16,7 +18,28 @@ namespace gd {
 const UsedExtensionsResult UsedExtensionsFinder::ScanProject(gd::Project& project) {
   UsedExtensionsFinder worker(project);
   gd::ProjectBrowserHelper::ExposeProjectObjects(project, worker);
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, worker);
+
+  // Events are only read, so they are scanned in parallel. The results are
+  // sets, so merging them doesn't depend on the threads.
+  UsedExtensionsResult& result = worker.result;
+  gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+      project,
+      [&project]() {
+        return std::unique_ptr<UsedExtensionsFinder>(
+            new UsedExtensionsFinder(project));
+      },
+      [&result](UsedExtensionsFinder& eventsWorker) {
+        const UsedExtensionsResult& eventsResult = eventsWorker.result;
+        result.GetUsedExtensions().insert(
+            eventsResult.GetUsedExtensions().begin(),
+            eventsResult.GetUsedExtensions().end());
+        result.GetUsedIncludeFiles().insert(
+            eventsResult.GetUsedIncludeFiles().begin(),
+            eventsResult.GetUsedIncludeFiles().end());
+        result.GetUsedRequiredFiles().insert(
+            eventsResult.GetUsedRequiredFiles().begin(),
+            eventsResult.GetUsedRequiredFiles().end());
+      });
   return worker.result;
 };
 
@@ -54,9 +77,11 @@ bool UsedExtensionsFinder::DoVisitInstruction(gd::Instruction& instruction,
                                               bool isCondition) {
   auto metadata =
       isCondition ? gd::MetadataProvider::GetExtensionAndConditionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType())
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol())
                   : gd::MetadataProvider::GetExtensionAndActionMetadata(
-                        project.GetCurrentPlatform(), instruction.GetType());
+                        project.GetCurrentPlatform(),
+                        instruction.GetTypeSymbol());
   result.GetUsedExtensions().insert(metadata.GetExtension().GetName());
   for (auto&& includeFile : metadata.GetMetadata().GetIncludeFiles()) {
     result.GetUsedIncludeFiles().insert(includeFile);
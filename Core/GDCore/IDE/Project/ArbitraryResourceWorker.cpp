@@ -213,9 +213,9 @@ bool ResourceWorkerInEventsWorker::DoVisitInstruction(gd::Instruction& instructi
   const auto& platform = project.GetCurrentPlatform();
   const auto& metadata = isCondition
                               ? gd::MetadataProvider::GetConditionMetadata(
-                                    platform, instruction.GetType())
+                                    platform, instruction.GetTypeSymbol())
                               : gd::MetadataProvider::GetActionMetadata(
-                                    platform, instruction.GetType());
+                                    platform, instruction.GetTypeSymbol());
 
   gd::ParameterMetadataTools::IterateOverParametersWithIndex(
       instruction.GetParameters(),
@@ -230,47 +230,57 @@ bool ResourceWorkerInEventsWorker::DoVisitInstruction(gd::Instruction& instructi
             parameterMetadata.GetType() == "fontResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeFont(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "soundfile" ||
                     parameterMetadata.GetType() ==
                         "musicfile") {  // Should be renamed audioResource
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeAudio(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "bitmapFontResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeBitmapFont(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "imageResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeImage(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "jsonResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeJson(updatedParameterValue);
           worker.ExposeEmbeddeds(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "tilemapResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeTilemap(updatedParameterValue);
           worker.ExposeEmbeddeds(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "tilesetResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeTileset(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "model3DResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeModel3D(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "atlasResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeAtlas(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         } else if (parameterMetadata.GetType() == "spineResource") {
           gd::String updatedParameterValue = parameterValue;
           worker.ExposeSpine(updatedParameterValue);
-          instruction.SetParameter(parameterIndex, updatedParameterValue);
+          if (updatedParameterValue != parameterValue)
+            instruction.SetParameter(parameterIndex, updatedParameterValue);
         }
       });
 
@@ -16,6 +16,49 @@
 
 using namespace std;
 
+namespace {
+/**
+ * Find if the project refers directly to files, instead of resources (this is
+ * the case for very old projects).
+ */
+class FilesReferencesFinder : public gd::ArbitraryResourceWorker {
+ public:
+  FilesReferencesFinder(gd::ResourcesManager& resourcesManager)
+      : gd::ArbitraryResourceWorker(resourcesManager),
+        hasFilesReferences(false){};
+  virtual ~FilesReferencesFinder(){};
+
+  void ExposeFile(gd::String& file) override { hasFilesReferences = true; };
+
+  bool hasFilesReferences;
+};
+
+void CopyFiles(const map<gd::String, gd::String>& resourcesNewFilename,
+               gd::AbstractFileSystem& fs,
+               const gd::String& destinationDirectory) {
+  for (map<gd::String, gd::String>::const_iterator it =
+           resourcesNewFilename.begin();
+       it != resourcesNewFilename.end();
+       ++it) {
+    if (!it->first.empty()) {
+      // Create the destination filename
+      gd::String destinationFile = it->second;
+      fs.MakeAbsolute(destinationFile, destinationDirectory);
+
+      // Be sure the directory exists
+      gd::String dir = fs.DirNameFrom(destinationFile);
+      if (!fs.DirExists(dir)) fs.MkDir(dir);
+
+      // We can now copy the file
+      if (!fs.CopyFile(it->first, destinationFile)) {
+        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
+                       destinationFile + _("\"."));
+      }
+    }
+  }
+}
+}  // namespace
+
 namespace gd {
 
 bool ProjectResourcesCopier::CopyAllResourcesTo(
@@ -65,28 +108,42 @@ bool ProjectResourcesCopier::CopyAllResourcesTo(
                                                     resourcesMergingHelper);
 
   // Copy resources
-  map<gd::String, gd::String>& resourcesNewFilename =
-      resourcesMergingHelper.GetAllResourcesOldAndNewFilename();
-  for (map<gd::String, gd::String>::const_iterator it =
-           resourcesNewFilename.begin();
-       it != resourcesNewFilename.end();
-       ++it) {
-    if (!it->first.empty()) {
-      // Create the destination filename
-      gd::String destinationFile = it->second;
-      fs.MakeAbsolute(destinationFile, destinationDirectory);
+  CopyFiles(resourcesMergingHelper.GetAllResourcesOldAndNewFilename(),
+            fs,
+            destinationDirectory);
 
-      // Be sure the directory exists
-      gd::String dir = fs.DirNameFrom(destinationFile);
-      if (!fs.DirExists(dir)) fs.MkDir(dir);
+  return true;
+}
 
-      // We can now copy the file
-      if (!fs.CopyFile(it->first, destinationFile)) {
-        gd::LogWarning(_("Unable to copy \"") + it->first + _("\" to \"") +
-                       destinationFile + _("\"."));
-      }
-    }
-  }
+bool ProjectResourcesCopier::CopyAllResourcesTo(
+    gd::Project& project,
+    gd::ResourcesManager& exportedResources,
+    AbstractFileSystem& fs,
+    gd::String destinationDirectory,
+    bool preserveAbsoluteFilenames,
+    bool preserveDirectoryStructure) {
+  FilesReferencesFinder filesReferencesFinder(project.GetResourcesManager());
+  gd::ResourceExposer::ExposeWholeProjectResourcesUsages(
+      project, filesReferencesFinder);
+  if (filesReferencesFinder.hasFilesReferences) return false;
+
+  auto projectDirectory = fs.DirNameFrom(project.GetProjectFile());
+  std::cout << "Copying all resources from " << projectDirectory << " to "
+            << destinationDirectory << "..." << std::endl;
+
+  // Only the files of the resources are to be copied, so the project is not
+  // exposed to the helper.
+  gd::ResourcesMergingHelper resourcesMergingHelper(exportedResources, fs);
+  resourcesMergingHelper.SetBaseDirectory(projectDirectory);
+  resourcesMergingHelper.PreserveDirectoriesStructure(
+      preserveDirectoryStructure);
+  resourcesMergingHelper.PreserveAbsoluteFilenames(preserveAbsoluteFilenames);
+  resourcesMergingHelper.ExposeResources();
+
+  // Copy resources
+  CopyFiles(resourcesMergingHelper.GetAllResourcesOldAndNewFilename(),
+            fs,
+            destinationDirectory);
 
   return true;
 }
@@ -10,6 +10,7 @@
 namespace gd {
 class Project;
 class AbstractFileSystem;
+class ResourcesManager;
 }  // namespace gd
 
 namespace gd {
@@ -49,6 +50,25 @@ class GD_CORE_API ProjectResourcesCopier {
                                  bool preserveAbsoluteFilenames = true,
                                  bool preserveDirectoryStructure = true);
 
+  /**
+   * \brief Copy all resources files of a project to the specified
+   * `destinationDirectory`, updating the filenames of `exportedResources`
+   * (usually a copy of the resources of the project) instead of the project.
+   *
+   * This avoids to copy the whole project when the project must not be
+   * updated.
+   *
+   * \return false, without copying anything, if the project refers directly
+   * to files (instead of resources) in its objects or events, as they would
+   * have to be updated in the project.
+   */
+  static bool CopyAllResourcesTo(gd::Project& project,
+                                 gd::ResourcesManager& exportedResources,
+                                 gd::AbstractFileSystem& fs,
+                                 gd::String destinationDirectory,
+                                 bool preserveAbsoluteFilenames = true,
+                                 bool preserveDirectoryStructure = true);
+
 private:
   static bool CopyAllResourcesTo(gd::Project& originalProject,
                                  gd::Project& clonedProject,
@@ -5,6 +5,8 @@
  */
 #include "ProjectBrowserHelper.h"
 
+#include "GDCore/Events/Parsers/ExpressionNodeCache.h"
+#include "GDCore/Extensions/Platform.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
 #include "GDCore/IDE/EventsFunctionTools.h"
 #include "GDCore/IDE/Project/ArbitraryEventBasedBehaviorsWorker.h"
@@ -327,6 +329,146 @@ void ProjectBrowserHelper::ExposeProjectEventBasedBehaviors(
   }
 }
 
+std::vector<ProjectBrowserHelper::EventsShard>
+ProjectBrowserHelper::GetProjectEventsShards(gd::Project &project) {
+  std::vector<EventsShard> shards;
+
+  // Add layouts events
+  for (std::size_t s = 0; s < project.GetLayoutsCount(); s++) {
+    gd::Layout *layout = &project.GetLayout(s);
+    shards.push_back([&project, layout](const EventsLauncher &launch) {
+      auto projectScopedContainers = gd::ProjectScopedContainers::
+          MakeNewProjectScopedContainersForProjectAndLayout(project, *layout);
+      launch(layout->GetEvents(), projectScopedContainers);
+    });
+  }
+  // Add external events events
+  for (std::size_t s = 0; s < project.GetExternalEventsCount(); s++) {
+    gd::ExternalEvents *externalEvents = &project.GetExternalEvents(s);
+    const gd::String &associatedLayout = externalEvents->GetAssociatedLayout();
+    if (!project.HasLayoutNamed(associatedLayout)) continue;
+
+    gd::Layout *layout = &project.GetLayout(associatedLayout);
+    shards.push_back(
+        [&project, layout, externalEvents](const EventsLauncher &launch) {
+          auto projectScopedContainers = gd::ProjectScopedContainers::
+              MakeNewProjectScopedContainersForProjectAndLayout(project,
+                                                                *layout);
+          launch(externalEvents->GetEvents(), projectScopedContainers);
+        });
+  }
+  // Add events based extensions
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       e++) {
+    const gd::EventsFunctionsExtension *eventsFunctionsExtension =
+        &project.GetEventsFunctionsExtension(e);
+
+    // Add (free) events functions
+    for (auto &&eventsFunctionUniquePtr :
+         eventsFunctionsExtension->GetInternalVector()) {
+      gd::EventsFunction *eventsFunction = eventsFunctionUniquePtr.get();
+      shards.push_back([&project, eventsFunctionsExtension,
+                        eventsFunction](const EventsLauncher &launch) {
+        gd::ObjectsContainer globalObjectsAndGroups;
+        gd::ObjectsContainer objectsAndGroups;
+        gd::EventsFunctionTools::FreeEventsFunctionToObjectsContainer(
+            project, *eventsFunctionsExtension, *eventsFunction,
+            globalObjectsAndGroups, objectsAndGroups);
+        auto projectScopedContainers =
+            gd::ProjectScopedContainers::MakeNewProjectScopedContainersFor(
+                globalObjectsAndGroups, objectsAndGroups);
+        projectScopedContainers.AddParameters(
+            eventsFunction->GetParametersForEvents(*eventsFunctionsExtension));
+
+        launch(eventsFunction->GetEvents(), projectScopedContainers);
+      });
+    }
+
+    // Add (behavior) events functions
+    for (auto &&eventsBasedBehaviorUniquePtr :
+         eventsFunctionsExtension->GetEventsBasedBehaviors()
+             .GetInternalVector()) {
+      const gd::EventsBasedBehavior *eventsBasedBehavior =
+          eventsBasedBehaviorUniquePtr.get();
+      for (auto &&eventsFunctionUniquePtr :
+           eventsBasedBehavior->GetEventsFunctions().GetInternalVector()) {
+        gd::EventsFunction *eventsFunction = eventsFunctionUniquePtr.get();
+        shards.push_back([&project, eventsBasedBehavior,
+                          eventsFunction](const EventsLauncher &launch) {
+          gd::ObjectsContainer globalObjectsAndGroups;
+          gd::ObjectsContainer objectsAndGroups;
+          gd::EventsFunctionTools::BehaviorEventsFunctionToObjectsContainer(
+              project, *eventsBasedBehavior, *eventsFunction,
+              globalObjectsAndGroups, objectsAndGroups);
+          auto projectScopedContainers =
+              gd::ProjectScopedContainers::MakeNewProjectScopedContainersFor(
+                  globalObjectsAndGroups, objectsAndGroups);
+          projectScopedContainers.AddPropertiesContainer(
+              eventsBasedBehavior->GetSharedPropertyDescriptors());
+          projectScopedContainers.AddPropertiesContainer(
+              eventsBasedBehavior->GetPropertyDescriptors());
+          projectScopedContainers.AddParameters(
+              eventsFunction->GetParametersForEvents(
+                  eventsBasedBehavior->GetEventsFunctions()));
+
+          launch(eventsFunction->GetEvents(), projectScopedContainers);
+        });
+      }
+    }
+
+    // Add (object) events functions
+    for (auto &&eventsBasedObjectUniquePtr :
+         eventsFunctionsExtension->GetEventsBasedObjects()
+             .GetInternalVector()) {
+      const gd::EventsBasedObject *eventsBasedObject =
+          eventsBasedObjectUniquePtr.get();
+      for (auto &&eventsFunctionUniquePtr :
+           eventsBasedObject->GetEventsFunctions().GetInternalVector()) {
+        gd::EventsFunction *eventsFunction = eventsFunctionUniquePtr.get();
+        shards.push_back([&project, eventsBasedObject,
+                          eventsFunction](const EventsLauncher &launch) {
+          gd::ObjectsContainer globalObjectsAndGroups;
+          gd::ObjectsContainer objectsAndGroups;
+          gd::EventsFunctionTools::ObjectEventsFunctionToObjectsContainer(
+              project, *eventsBasedObject, *eventsFunction,
+              globalObjectsAndGroups, objectsAndGroups);
+          auto projectScopedContainers =
+              gd::ProjectScopedContainers::MakeNewProjectScopedContainersFor(
+                  globalObjectsAndGroups, objectsAndGroups);
+          projectScopedContainers.AddPropertiesContainer(
+              eventsBasedObject->GetPropertyDescriptors());
+          projectScopedContainers.AddParameters(
+              eventsFunction->GetParametersForEvents(
+                  eventsBasedObject->GetEventsFunctions()));
+
+          launch(eventsFunction->GetEvents(), projectScopedContainers);
+        });
+      }
+    }
+  }
+
+  return shards;
+}
+
+void ProjectBrowserHelper::LaunchWorker(
+    gd::ArbitraryEventsWorkerWithContext &worker, gd::EventsList &events,
+    const gd::ProjectScopedContainers &projectScopedContainers) {
+  worker.Launch(events, projectScopedContainers);
+}
+
+void ProjectBrowserHelper::LaunchWorker(
+    gd::ReadOnlyArbitraryEventsWorkerWithContext &worker,
+    const gd::EventsList &events,
+    const gd::ProjectScopedContainers &projectScopedContainers) {
+  worker.Launch(events, projectScopedContainers);
+}
+
+void ProjectBrowserHelper::PrepareConcurrentEventsExposure(
+    gd::Project &project) {
+  project.GetCurrentPlatform().GetMetadataIndex();
+  gd::ExpressionNodeCache::Get();
+}
+
 void ProjectBrowserHelper::ExposeProjectSharedDatas(
     gd::Project &project, gd::ArbitraryBehaviorSharedDataWorker &worker) {
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
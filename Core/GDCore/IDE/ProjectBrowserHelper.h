@@ -4,6 +4,11 @@
  * reserved. This project is released under the MIT License.
  */
 #pragma once
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "GDCore/Tools/ParallelFor.h"
 
 namespace gd {
 class Project;
@@ -13,8 +18,11 @@ class EventsFunctionsExtension;
 class EventsFunction;
 class EventsBasedBehavior;
 class EventsBasedObject;
+class EventsList;
+class ProjectScopedContainers;
 class ArbitraryEventsWorker;
 class ArbitraryEventsWorkerWithContext;
+class ReadOnlyArbitraryEventsWorkerWithContext;
 class ArbitraryEventsFunctionsWorker;
 class ArbitraryObjectsWorker;
 class ArbitraryEventBasedBehaviorsWorker;
@@ -193,6 +201,74 @@ public:
    */
   static void ExposeProjectSharedDatas(gd::Project &project,
                                        gd::ArbitraryBehaviorSharedDataWorker &worker);
+
+  /**
+   * \brief Call a new worker on each layout, external events and events
+   * function of the project, using several threads on native builds (see
+   * gd::ParallelFor).
+   *
+   * The events exposed are the same as with ExposeProjectEvents (for a worker
+   * with context). A worker is made by \a makeWorker for each of them, then
+   * the workers are given to \a mergeWorker in the order ExposeProjectEvents
+   * would have exposed the events, so that the merged results don't depend on
+   * the threads.
+   *
+   * \warning The workers must only read the project and must not share
+   * anything that is not safe to use from several threads.
+   */
+  template <class MakeWorker, class MergeWorker>
+  static void ExposeProjectEventsInParallel(gd::Project &project,
+                                            MakeWorker makeWorker,
+                                            MergeWorker mergeWorker) {
+    std::vector<EventsShard> shards = GetProjectEventsShards(project);
+    std::vector<decltype(makeWorker())> workers;
+    for (std::size_t i = 0; i < shards.size(); ++i)
+      workers.push_back(makeWorker());
+
+    PrepareConcurrentEventsExposure(project);
+    gd::ParallelFor(shards.size(), [&shards, &workers](std::size_t i) {
+      auto &worker = *workers[i];
+      shards[i]([&worker](gd::EventsList &events,
+                          const gd::ProjectScopedContainers
+                              &projectScopedContainers) {
+        LaunchWorker(worker, events, projectScopedContainers);
+      });
+    });
+
+    for (auto &worker : workers) mergeWorker(*worker);
+  }
+
+private:
+  typedef std::function<void(gd::EventsList &,
+                             const gd::ProjectScopedContainers &)>
+      EventsLauncher;
+  /**
+   * A part of the events of the project, exposed with its context to the
+   * given launcher.
+   */
+  typedef std::function<void(const EventsLauncher &)> EventsShard;
+
+  /**
+   * \brief Split the events of the project exposed by ExposeProjectEvents
+   * (for a worker with context) by layout, external events and events
+   * function.
+   */
+  static std::vector<EventsShard> GetProjectEventsShards(gd::Project &project);
+
+  static void
+  LaunchWorker(gd::ArbitraryEventsWorkerWithContext &worker,
+               gd::EventsList &events,
+               const gd::ProjectScopedContainers &projectScopedContainers);
+  static void
+  LaunchWorker(gd::ReadOnlyArbitraryEventsWorkerWithContext &worker,
+               const gd::EventsList &events,
+               const gd::ProjectScopedContainers &projectScopedContainers);
+
+  /**
+   * \brief Build what is built on first use when exposing events, so that
+   * it's not built concurrently by several threads.
+   */
+  static void PrepareConcurrentEventsExposure(gd::Project &project);
 };
 
 } // namespace gd
@@ -13,6 +13,49 @@
 #include "GDCore/Project/Project.h"
 #include "GDCore/IDE/WholeProjectBrowser.h"
 #include "GDCore/IDE/Events/BehaviorDefaultFlagClearer.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/ObjectsContainer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace {
+/**
+ * Replace a child of the element by an empty array.
+ */
+void ClearSerializedArray(gd::SerializerElement &element,
+                          const gd::String &childName,
+                          const gd::String &arrayOf) {
+  gd::SerializerElement &childElement = element.GetChild(childName);
+  childElement = gd::SerializerElement();
+  childElement.ConsiderAsArrayOf(arrayOf);
+}
+
+/**
+ * Serialize again the behaviors of the objects having default behaviors, so
+ * that these ones are included (like if their default flag was cleared).
+ */
+void SerializeDefaultBehaviors(const gd::ObjectsContainer &objectsContainer,
+                               gd::SerializerElement &objectsElement) {
+  objectsElement.ConsiderAsArrayOf("object");
+  for (std::size_t i = 0; i < objectsContainer.GetObjectsCount(); ++i) {
+    const gd::Object &object = objectsContainer.GetObject(i);
+    bool hasDefaultBehaviors = false;
+    for (const gd::String &behaviorName : object.GetAllBehaviorNames()) {
+      if (object.GetBehavior(behaviorName).IsDefaultBehavior()) {
+        hasDefaultBehaviors = true;
+        break;
+      }
+    }
+    if (!hasDefaultBehaviors) continue;
+
+    gd::SerializerElement &behaviorsElement =
+        objectsElement.GetChild(i).GetChild("behaviors");
+    behaviorsElement = gd::SerializerElement();
+    object.SerializeBehaviorsTo(behaviorsElement, true);
+  }
+}
+}  // namespace
 
 namespace gd {
 
@@ -54,4 +97,59 @@ void GD_CORE_API ProjectStripper::StripProjectForExport(gd::Project &project) {
   }
 }
 
+void GD_CORE_API ProjectStripper::StripSerializedProjectForExport(
+    const gd::Project &project, gd::SerializerElement &projectElement) {
+  ClearSerializedArray(projectElement, "objectsGroups", "group");
+  ClearSerializedArray(projectElement, "externalEvents", "externalEvents");
+
+  SerializeDefaultBehaviors(project, projectElement.GetChild("objects"));
+
+  gd::SerializerElement &layoutsElement = projectElement.GetChild("layouts");
+  layoutsElement.ConsiderAsArrayOf("layout");
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
+    gd::SerializerElement &layoutElement = layoutsElement.GetChild(i);
+    SerializeDefaultBehaviors(project.GetLayout(i),
+                              layoutElement.GetChild("objects"));
+    ClearSerializedArray(layoutElement, "objectsGroups", "group");
+    ClearSerializedArray(layoutElement, "events", "event");
+  }
+
+  // Keep the EventsBasedObject object list because it's useful for the Runtime
+  // to create the child-object. Extensions are serialized again, as the ones
+  // without EventsBasedObject are removed.
+  gd::SerializerElement &extensionsElement =
+      projectElement.GetChild("eventsFunctionsExtensions");
+  extensionsElement = gd::SerializerElement();
+  extensionsElement.ConsiderAsArrayOf("eventsFunctionsExtension");
+  for (std::size_t e = 0; e < project.GetEventsFunctionsExtensionsCount();
+       ++e) {
+    const auto &extension = project.GetEventsFunctionsExtension(e);
+    const auto &eventsBasedObjects = extension.GetEventsBasedObjects();
+    if (eventsBasedObjects.size() == 0) continue;
+
+    gd::SerializerElement &extensionElement =
+        extensionsElement.AddChild("eventsFunctionsExtension");
+    extension.SerializeTo(extensionElement);
+
+    gd::SerializerElement &eventsBasedObjectsElement =
+        extensionElement.GetChild("eventsBasedObjects");
+    eventsBasedObjectsElement.ConsiderAsArrayOf("eventsBasedObject");
+    for (std::size_t o = 0; o < eventsBasedObjects.size(); ++o) {
+      gd::SerializerElement &eventsBasedObjectElement =
+          eventsBasedObjectsElement.GetChild(o);
+      eventsBasedObjectElement.SetAttribute("fullName", "");
+      eventsBasedObjectElement.SetAttribute("description", "");
+      ClearSerializedArray(
+          eventsBasedObjectElement, "eventsFunctions", "eventsFunction");
+      ClearSerializedArray(eventsBasedObjectElement,
+                           "propertyDescriptors",
+                           "propertyDescriptor");
+      SerializeDefaultBehaviors(eventsBasedObjects.at(o),
+                                eventsBasedObjectElement.GetChild("objects"));
+    }
+    ClearSerializedArray(
+        extensionElement, "eventsBasedBehaviors", "eventsBasedBehavior");
+  }
+}
+
 } // namespace gd
@@ -7,6 +7,7 @@
 #define GDCORE_PROJECTSTRIPPER_H
 namespace gd {
 class Project;
+class SerializerElement;
 }
 namespace gd {
 class String;
@@ -28,6 +29,17 @@ class GD_CORE_API ProjectStripper {
    */
   static void StripProjectForExport(gd::Project& project);
 
+  /**
+   * \brief Strip the serialization of a project for export, like
+   * StripProjectForExport would strip the project before serializing it, but
+   * without modifying (or copying) the project.
+   *
+   * \param project The project, left untouched.
+   * \param projectElement The serialization of the project, to be stripped.
+   */
+  static void StripSerializedProjectForExport(
+      const gd::Project& project, gd::SerializerElement& projectElement);
+
  private:
   ProjectStripper(){};
   virtual ~ProjectStripper(){};
@@ -36,6 +36,11 @@ void ResourceExposer::ExposeWholeProjectResources(gd::Project& project, gd::Arbi
   // Expose any project resources as files.
   worker.ExposeResources();
 
+  ExposeWholeProjectResourcesUsages(project, worker);
+}
+
+void ResourceExposer::ExposeWholeProjectResourcesUsages(
+    gd::Project& project, gd::ArbitraryResourceWorker& worker) {
   project.GetPlatformSpecificAssets().ExposeResources(worker);
 
   // Expose event resources
@@ -32,6 +32,13 @@ public:
   static void ExposeWholeProjectResources(gd::Project &project,
                                           gd::ArbitraryResourceWorker &worker);
 
+  /**
+   * @brief Expose the resources used in the whole project (by objects,
+   * events, effects...), without the files of the resources themselves.
+   */
+  static void ExposeWholeProjectResourcesUsages(
+      gd::Project &project, gd::ArbitraryResourceWorker &worker);
+
   /**
    * @brief Expose only the resources used globally on a project.
    * 
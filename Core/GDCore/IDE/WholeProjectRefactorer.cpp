@@ -7,12 +7,14 @@
 
 #include <unordered_map>
 
+#include "GDCore/Events/EventsList.h"
 #include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/DependenciesAnalyzer.h"
 #include "GDCore/IDE/EventBasedBehaviorBrowser.h"
 #include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersGroup.h"
 #include "GDCore/IDE/Events/BehaviorTypeRenamer.h"
 #include "GDCore/IDE/Events/CustomObjectTypeRenamer.h"
 #include "GDCore/IDE/Events/EventsBehaviorRenamer.h"
@@ -64,6 +66,24 @@ const gd::String WholeProjectRefactorer::behaviorObjectParameterName = "Object";
 // always called "Object".
 const gd::String WholeProjectRefactorer::parentObjectParameterName = "Object";
 
+namespace {
+/**
+ * Index the symbols of the events lists, without visiting their events.
+ */
+class EventsSymbolsIndexer : public gd::ArbitraryEventsWorker {
+ private:
+  bool ShouldVisitEventsList(gd::EventsList &events) override {
+    events.IndexSymbols();
+    return false;
+  }
+};
+}  // namespace
+
+void WholeProjectRefactorer::IndexEventsSymbols(gd::Project &project) {
+  EventsSymbolsIndexer indexer;
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, indexer);
+}
+
 std::set<gd::String>
 WholeProjectRefactorer::GetAllObjectTypesUsingEventsBasedBehavior(
     const gd::Project &project,
@@ -228,20 +248,36 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
     const gd::EventsFunctionsExtension &eventsFunctionsExtension,
     const gd::String &oldName, const gd::String &newName,
     const gd::ProjectBrowser &projectBrowser) {
-  auto renameEventsFunction = [&project, &oldName, &newName, &projectBrowser](
+  // The renamers are launched together, in a single pass over the events for
+  // the expressions and another one for the instructions.
+  std::vector<gd::ExpressionsRenamer> expressionsRenamers;
+  std::vector<gd::InstructionsTypeRenamer> instructionsRenamers;
+
+  auto renameEventsFunction = [&project, &oldName, &newName,
+                               &expressionsRenamers, &instructionsRenamers](
                                   const gd::EventsFunction &eventsFunction) {
-    DoRenameEventsFunction(project, eventsFunction,
-                           gd::PlatformExtension::GetEventsFunctionFullType(
-                               oldName, eventsFunction.GetName()),
-                           gd::PlatformExtension::GetEventsFunctionFullType(
-                               newName, eventsFunction.GetName()),
-                           projectBrowser);
+    const gd::String oldFullType =
+        gd::PlatformExtension::GetEventsFunctionFullType(
+            oldName, eventsFunction.GetName());
+    const gd::String newFullType =
+        gd::PlatformExtension::GetEventsFunctionFullType(
+            newName, eventsFunction.GetName());
+    if (eventsFunction.IsExpression()) {
+      gd::ExpressionsRenamer renamer =
+          gd::ExpressionsRenamer(project.GetCurrentPlatform());
+      renamer.SetReplacedFreeExpression(oldFullType, newFullType);
+      expressionsRenamers.push_back(renamer);
+    }
+    if (eventsFunction.IsAction() || eventsFunction.IsCondition()) {
+      instructionsRenamers.push_back(
+          gd::InstructionsTypeRenamer(project, oldFullType, newFullType));
+    }
   };
 
   auto renameBehaviorEventsFunction =
-      [&project, &oldName, &newName,
-       &projectBrowser](const gd::EventsBasedBehavior &eventsBasedBehavior,
-                        const gd::EventsFunction &eventsFunction) {
+      [&project, &oldName, &newName, &instructionsRenamers](
+          const gd::EventsBasedBehavior &eventsBasedBehavior,
+          const gd::EventsFunction &eventsFunction) {
         if (eventsFunction.IsExpression()) {
           // Nothing to do, expressions are not including the extension name
         }
@@ -254,14 +290,14 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
               gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
                   newName, eventsBasedBehavior.GetName(),
                   eventsFunction.GetName()));
-          projectBrowser.ExposeEvents(project, renamer);
+          instructionsRenamers.push_back(renamer);
         }
       };
 
   auto renameBehaviorPropertyFunctions =
-      [&project, &oldName, &newName,
-       &projectBrowser](const gd::EventsBasedBehavior &eventsBasedBehavior,
-                        const gd::NamedPropertyDescriptor &property) {
+      [&project, &oldName, &newName, &instructionsRenamers](
+          const gd::EventsBasedBehavior &eventsBasedBehavior,
+          const gd::NamedPropertyDescriptor &property) {
         gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
             project,
             gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
@@ -272,7 +308,7 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
                 newName, eventsBasedBehavior.GetName(),
                 gd::EventsBasedBehavior::GetPropertyActionName(
                     property.GetName())));
-        projectBrowser.ExposeEvents(project, actionRenamer);
+        instructionsRenamers.push_back(actionRenamer);
 
         gd::InstructionsTypeRenamer conditionRenamer =
             gd::InstructionsTypeRenamer(
@@ -285,16 +321,16 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
                     newName, eventsBasedBehavior.GetName(),
                     gd::EventsBasedBehavior::GetPropertyConditionName(
                         property.GetName())));
-        projectBrowser.ExposeEvents(project, conditionRenamer);
+        instructionsRenamers.push_back(conditionRenamer);
 
         // Nothing to do for expressions, expressions are not including the
         // extension name
       };
 
   auto renameBehaviorSharedPropertyFunctions =
-      [&project, &oldName, &newName,
-       &projectBrowser](const gd::EventsBasedBehavior &eventsBasedBehavior,
-                        const gd::NamedPropertyDescriptor &property) {
+      [&project, &oldName, &newName, &instructionsRenamers](
+          const gd::EventsBasedBehavior &eventsBasedBehavior,
+          const gd::NamedPropertyDescriptor &property) {
         gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
             project,
             gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
@@ -305,7 +341,7 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
                 newName, eventsBasedBehavior.GetName(),
                 gd::EventsBasedBehavior::GetSharedPropertyActionName(
                     property.GetName())));
-        projectBrowser.ExposeEvents(project, actionRenamer);
+        instructionsRenamers.push_back(actionRenamer);
 
         gd::InstructionsTypeRenamer conditionRenamer =
             gd::InstructionsTypeRenamer(
@@ -318,16 +354,16 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
                     newName, eventsBasedBehavior.GetName(),
                     gd::EventsBasedBehavior::GetSharedPropertyConditionName(
                         property.GetName())));
-        projectBrowser.ExposeEvents(project, conditionRenamer);
+        instructionsRenamers.push_back(conditionRenamer);
 
         // Nothing to do for expressions, expressions are not including the
         // extension name
       };
 
   auto renameObjectEventsFunction =
-      [&project, &oldName, &newName,
-       &projectBrowser](const gd::EventsBasedObject &eventsBasedObject,
-                        const gd::EventsFunction &eventsFunction) {
+      [&project, &oldName, &newName, &instructionsRenamers](
+          const gd::EventsBasedObject &eventsBasedObject,
+          const gd::EventsFunction &eventsFunction) {
         if (eventsFunction.IsExpression()) {
           // Nothing to do, expressions are not including the extension name
         }
@@ -340,14 +376,14 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
               gd::PlatformExtension::GetObjectEventsFunctionFullType(
                   newName, eventsBasedObject.GetName(),
                   eventsFunction.GetName()));
-          projectBrowser.ExposeEvents(project, renamer);
+          instructionsRenamers.push_back(renamer);
         }
       };
 
   auto renameObjectPropertyFunctions =
-      [&project, &oldName, &newName,
-       &projectBrowser](const gd::EventsBasedObject &eventsBasedObject,
-                        const gd::NamedPropertyDescriptor &property) {
+      [&project, &oldName, &newName, &instructionsRenamers](
+          const gd::EventsBasedObject &eventsBasedObject,
+          const gd::NamedPropertyDescriptor &property) {
         gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
             project,
             gd::PlatformExtension::GetObjectEventsFunctionFullType(
@@ -358,7 +394,7 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
                 newName, eventsBasedObject.GetName(),
                 gd::EventsBasedObject::GetPropertyActionName(
                     property.GetName())));
-        projectBrowser.ExposeEvents(project, actionRenamer);
+        instructionsRenamers.push_back(actionRenamer);
 
         gd::InstructionsTypeRenamer conditionRenamer =
             gd::InstructionsTypeRenamer(
@@ -371,7 +407,7 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
                     newName, eventsBasedObject.GetName(),
                     gd::EventsBasedObject::GetPropertyConditionName(
                         property.GetName())));
-        projectBrowser.ExposeEvents(project, conditionRenamer);
+        instructionsRenamers.push_back(conditionRenamer);
 
         // Nothing to do for expressions, expressions are not including the
         // extension name
@@ -452,6 +488,16 @@ void WholeProjectRefactorer::RenameEventsFunctionsExtension(
     }
   }
 
+  gd::ArbitraryEventsWorkersGroupWithContext expressionsRenamersGroup;
+  for (auto &renamer : expressionsRenamers)
+    expressionsRenamersGroup.AddWorker(renamer);
+  projectBrowser.ExposeEvents(project, expressionsRenamersGroup);
+
+  gd::ArbitraryEventsWorkersGroup instructionsRenamersGroup;
+  for (auto &renamer : instructionsRenamers)
+    instructionsRenamersGroup.AddWorker(renamer);
+  projectBrowser.ExposeEvents(project, instructionsRenamersGroup);
+
   // Finally, rename behaviors used in objects
   for (auto &&eventsBasedBehavior :
        eventsFunctionsExtension.GetEventsBasedBehaviors().GetInternalVector()) {
@@ -739,7 +785,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
         EventsBasedBehavior::GetPropertyExpressionName(oldPropertyName),
         EventsBasedBehavior::GetPropertyExpressionName(newPropertyName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
 
     std::unordered_map<gd::String, gd::String> oldToNewPropertyNames = {
         {oldPropertyName, newPropertyName}};
@@ -747,8 +792,10 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
     gd::EventsPropertyReplacer eventsPropertyReplacer(
         project.GetCurrentPlatform(), properties, oldToNewPropertyNames,
         removedPropertyNames);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project,
-                                                  eventsPropertyReplacer);
+    gd::ArbitraryEventsWorkersGroupWithContext expressionsRenamers;
+    expressionsRenamers.AddWorker(expressionRenamer)
+        .AddWorker(eventsPropertyReplacer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionsRenamers);
 
     gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
         project,
@@ -758,7 +805,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetPropertyActionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
     gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
         project,
@@ -768,7 +814,10 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorProperty(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetPropertyConditionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+    gd::ArbitraryEventsWorkersGroup instructionsRenamers;
+    instructionsRenamers.AddWorker(actionRenamer).AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project,
+                                                  instructionsRenamers);
   }
 }
 
@@ -809,7 +858,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName()),
         EventsBasedBehavior::GetSharedPropertyExpressionName(oldPropertyName),
         EventsBasedBehavior::GetSharedPropertyExpressionName(newPropertyName));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
 
     std::unordered_map<gd::String, gd::String> oldToNewPropertyNames = {
         {oldPropertyName, newPropertyName}};
@@ -817,8 +865,10 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
     gd::EventsPropertyReplacer eventsPropertyReplacer(
         project.GetCurrentPlatform(), properties, oldToNewPropertyNames,
         removedPropertyNames);
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project,
-                                                  eventsPropertyReplacer);
+    gd::ArbitraryEventsWorkersGroupWithContext expressionsRenamers;
+    expressionsRenamers.AddWorker(expressionRenamer)
+        .AddWorker(eventsPropertyReplacer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionsRenamers);
 
     gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
         project,
@@ -828,7 +878,6 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
         gd::PlatformExtension::GetBehaviorEventsFunctionFullType(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetSharedPropertyActionName(newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
     gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
         project,
@@ -840,7 +889,10 @@ void WholeProjectRefactorer::RenameEventsBasedBehaviorSharedProperty(
             eventsFunctionsExtension.GetName(), eventsBasedBehavior.GetName(),
             EventsBasedBehavior::GetSharedPropertyConditionName(
                 newPropertyName)));
-    gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+    gd::ArbitraryEventsWorkersGroup instructionsRenamers;
+    instructionsRenamers.AddWorker(actionRenamer).AddWorker(conditionRenamer);
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project,
+                                                  instructionsRenamers);
   }
 }
 
@@ -866,7 +918,6 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
           eventsFunctionsExtension.GetName(), eventsBasedObject.GetName()),
       EventsBasedObject::GetPropertyExpressionName(oldPropertyName),
       EventsBasedObject::GetPropertyExpressionName(newPropertyName));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionRenamer);
 
   std::unordered_map<gd::String, gd::String> oldToNewPropertyNames = {
       {oldPropertyName, newPropertyName}};
@@ -874,8 +925,10 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
   gd::EventsPropertyReplacer eventsPropertyReplacer(
       project.GetCurrentPlatform(), properties, oldToNewPropertyNames,
       removedPropertyNames);
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project,
-                                                eventsPropertyReplacer);
+  gd::ArbitraryEventsWorkersGroupWithContext expressionsRenamers;
+  expressionsRenamers.AddWorker(expressionRenamer)
+      .AddWorker(eventsPropertyReplacer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, expressionsRenamers);
 
   gd::InstructionsTypeRenamer actionRenamer = gd::InstructionsTypeRenamer(
       project,
@@ -885,7 +938,6 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
       gd::PlatformExtension::GetObjectEventsFunctionFullType(
           eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
           EventsBasedObject::GetPropertyActionName(newPropertyName)));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, actionRenamer);
 
   gd::InstructionsTypeRenamer conditionRenamer = gd::InstructionsTypeRenamer(
       project,
@@ -895,7 +947,9 @@ void WholeProjectRefactorer::RenameEventsBasedObjectProperty(
       gd::PlatformExtension::GetObjectEventsFunctionFullType(
           eventsFunctionsExtension.GetName(), eventsBasedObject.GetName(),
           EventsBasedObject::GetPropertyConditionName(newPropertyName)));
-  gd::ProjectBrowserHelper::ExposeProjectEvents(project, conditionRenamer);
+  gd::ArbitraryEventsWorkersGroup instructionsRenamers;
+  instructionsRenamers.AddWorker(actionRenamer).AddWorker(conditionRenamer);
+  gd::ProjectBrowserHelper::ExposeProjectEvents(project, instructionsRenamers);
 }
 
 void WholeProjectRefactorer::AddBehaviorAndRequiredBehaviors(
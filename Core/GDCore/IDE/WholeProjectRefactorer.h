@@ -58,6 +58,15 @@ struct VariablesChangeset {
 class GD_CORE_API WholeProjectRefactorer {
  public:
 
+  /**
+   * \brief Index the symbols used by all the events of the project, so that
+   * refactorings only visit the events lists that may use the renamed or
+   * removed elements.
+   *
+   * \see gd::EventsList::IndexSymbols
+   */
+  static void IndexEventsSymbols(gd::Project &project);
+
   /**
    * \brief Compute the changes made on the variables of a variable container.
    */
@@ -22,9 +22,13 @@ EventsBasedObject::EventsBasedObject()
 EventsBasedObject::~EventsBasedObject() {}
 
 EventsBasedObject::EventsBasedObject(const gd::EventsBasedObject &_eventBasedObject)
-        : AbstractEventsBasedEntity(_eventBasedObject) {
+        : AbstractEventsBasedEntity(_eventBasedObject),
+          isRenderedIn3D(_eventBasedObject.isRenderedIn3D),
+          isAnimatable(_eventBasedObject.isAnimatable),
+          isTextContainer(_eventBasedObject.isTextContainer) {
   // TODO Add a copy constructor in ObjectsContainer.
   initialObjects = gd::Clone(_eventBasedObject.initialObjects);
+  initialObjectsIndex.Invalidate();
   objectGroups = _eventBasedObject.objectGroups;
 }
 
@@ -18,8 +18,7 @@ namespace gd {
 gd::String* InitialInstance::badStringPropertyValue = NULL;
 
 InitialInstance::InitialInstance()
-    : objectName(""),
-      x(0),
+    : x(0),
       y(0),
       z(0),
       angle(0),
@@ -10,6 +10,7 @@
 
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/Symbol.h"
 namespace gd {
 class PropertyDescriptor;
 class Project;
@@ -47,10 +48,21 @@ class GD_CORE_API InitialInstance {
    */
   const gd::String& GetObjectName() const { return objectName; }
 
+  /**
+   * \brief Get the name of object instantiated on the layout, as an interned
+   * symbol (to compare it with other names without comparing strings).
+   */
+  const gd::Symbol& GetObjectNameSymbol() const { return objectName; }
+
+  /**
+   * \brief Set the name of object instantiated on the layout.
+   */
+  void SetObjectName(const gd::String& name) { objectName = gd::Symbol(name); }
+
   /**
    * \brief Set the name of object instantiated on the layout.
    */
-  void SetObjectName(const gd::String& name) { objectName = name; }
+  void SetObjectName(const gd::Symbol& name) { objectName = name; }
 
   /**
    * \brief Get the X position of the instance
@@ -334,7 +346,8 @@ class GD_CORE_API InitialInstance {
   std::map<gd::String, gd::String>
       stringProperties;  ///< More data which can be used by the object
 
-  gd::String objectName;  ///< Object name
+  gd::Symbol objectName;  ///< Object name, shared by all the instances of
+                          ///< the object.
   double x;               ///< Instance X position
   double y;               ///< Instance Y position
   double z;               ///< Instance Z position (for a 3D object)
@@ -108,15 +108,24 @@ gd::InitialInstance& InitialInstancesContainer::InsertInitialInstance(
 
 void InitialInstancesContainer::RenameInstancesOfObject(
     const gd::String& oldName, const gd::String& newName) {
+  gd::Symbol oldSymbol;
+  if (!gd::Symbol::FindExisting(oldName, oldSymbol))
+    return;  // No instance can have this name.
+
+  gd::Symbol newSymbol(newName);
   for (gd::InitialInstance& instance : initialInstances) {
-    if (instance.GetObjectName() == oldName) instance.SetObjectName(newName);
+    if (instance.GetObjectNameSymbol() == oldSymbol)
+      instance.SetObjectName(newSymbol);
   }
 }
 
 void InitialInstancesContainer::RemoveInitialInstancesOfObject(
     const gd::String& objectName) {
-  RemoveInstanceIf([&objectName](const InitialInstance& currentInstance) {
-    return currentInstance.GetObjectName() == objectName;
+  gd::Symbol objectSymbol;
+  if (!gd::Symbol::FindExisting(objectName, objectSymbol)) return;
+
+  RemoveInstanceIf([&objectSymbol](const InitialInstance& currentInstance) {
+    return currentInstance.GetObjectNameSymbol() == objectSymbol;
   });
 }
 
@@ -156,10 +165,14 @@ bool InitialInstancesContainer::SomeInstancesAreOnLayer(
 
 bool InitialInstancesContainer::HasInstancesOfObject(
     const gd::String& objectName) const {
+  gd::Symbol objectSymbol;
+  if (!gd::Symbol::FindExisting(objectName, objectSymbol)) return false;
+
   return std::any_of(initialInstances.begin(),
                      initialInstances.end(),
-                     [&objectName](const InitialInstance& currentInstance) {
-                       return currentInstance.GetObjectName() == objectName;
+                     [&objectSymbol](const InitialInstance& currentInstance) {
+                       return currentInstance.GetObjectNameSymbol() ==
+                              objectSymbol;
                      });
 }
 
@@ -61,6 +61,7 @@ Layout::Layout()
 }
 
 void Layout::SetName(const gd::String& name_) {
+  if (!name.empty() && name != name_) gd::NameIndex::NotifyNameChanged();
   name = name_;
   mangledName = gd::SceneNameMangler::Get()->GetMangledSceneName(name);
 };
@@ -419,6 +420,7 @@ void Layout::Init(const Layout& other) {
   variables = other.GetVariables();
 
   initialObjects = gd::Clone(other.initialObjects);
+  initialObjectsIndex.Invalidate();
 
   behaviorsSharedData.clear();
   for (const auto& it : other.behaviorsSharedData) {
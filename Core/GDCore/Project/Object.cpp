@@ -37,7 +37,7 @@ Object::Object(const gd::String& name_,
 
 void Object::Init(const gd::Object& object) {
   persistentUuid = object.persistentUuid;
-  name = object.name;
+  SetName(object.name);
   assetStoreId = object.assetStoreId;
   objectVariables = object.objectVariables;
   effectsContainer = object.effectsContainer;
@@ -132,7 +132,7 @@ void Object::UnserializeFrom(gd::Project& project,
 
   SetType(element.GetStringAttribute("type"));
   assetStoreId = element.GetStringAttribute("assetStoreId");
-  name = element.GetStringAttribute("name", name, "nom");
+  SetName(element.GetStringAttribute("name", name, "nom"));
 
   objectVariables.UnserializeFrom(
       element.GetChild("variables", 0, "Variables"));
@@ -208,14 +208,20 @@ void Object::SerializeTo(SerializerElement& element) const {
   objectVariables.SerializeTo(element.AddChild("variables"));
   effectsContainer.SerializeTo(element.AddChild("effects"));
 
-  SerializerElement& behaviorsElement = element.AddChild("behaviors");
+  SerializeBehaviorsTo(element.AddChild("behaviors"), false);
+
+  configuration->SerializeTo(element);
+}
+
+void Object::SerializeBehaviorsTo(SerializerElement& behaviorsElement,
+                                  bool includeDefaultBehaviors) const {
   behaviorsElement.ConsiderAsArrayOf("behavior");
   std::vector<gd::String> allBehaviors = GetAllBehaviorNames();
   for (std::size_t i = 0; i < allBehaviors.size(); ++i) {
     const gd::Behavior& behavior = GetBehavior(allBehaviors[i]);
     // Default behaviors are added at the object creation according to metadata.
     // They don't need to be serialized.
-    if (behavior.IsDefaultBehavior()) {
+    if (behavior.IsDefaultBehavior() && !includeDefaultBehaviors) {
       continue;
     }
     SerializerElement& behaviorElement = behaviorsElement.AddChild("behavior");
@@ -227,8 +233,6 @@ void Object::SerializeTo(SerializerElement& element) const {
     behaviorElement.SetAttribute("type", behavior.GetTypeName());
     behaviorElement.SetAttribute("name", behavior.GetName());
   }
-
-  configuration->SerializeTo(element);
 }
 
 Object& Object::ResetPersistentUuid() {
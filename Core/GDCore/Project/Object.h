@@ -15,6 +15,7 @@
 #include "GDCore/Project/VariablesContainer.h"
 #include "GDCore/String.h"
 #include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/NameIndex.h"
 #include "GDCore/Vector2.h"
 
 namespace gd {
@@ -96,7 +97,10 @@ class GD_CORE_API Object {
 
   /** \brief Change the name of the object with the name passed as parameter.
    */
-  void SetName(const gd::String& name_) { name = name_; };
+  void SetName(const gd::String& name_) {
+    if (!name.empty() && name != name_) gd::NameIndex::NotifyNameChanged();
+    name = name_;
+  };
 
   /** \brief Return the name of the object.
    */
@@ -227,6 +231,14 @@ class GD_CORE_API Object {
    */
   void SerializeTo(SerializerElement& element) const;
 
+  /**
+   * \brief Serialize the behaviors of the object, including the default ones
+   * if \a includeDefaultBehaviors is true (the default behaviors are
+   * otherwise added back when the object is created).
+   */
+  void SerializeBehaviorsTo(SerializerElement& behaviorsElement,
+                            bool includeDefaultBehaviors) const;
+
   /**
    * \brief Unserialize the object.
    * \see DoUnserializeFrom
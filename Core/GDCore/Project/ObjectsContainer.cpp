@@ -47,6 +47,7 @@ void ObjectsContainer::AddMissingObjectsInRootFolder() {
 void ObjectsContainer::UnserializeObjectsFrom(
     gd::Project& project, const SerializerElement& element) {
   initialObjects.clear();
+  initialObjectsIndex.Invalidate();
   element.ConsiderAsArrayOf("object", "Objet");
   for (std::size_t i = 0; i < element.GetChildrenCount(); ++i) {
     const SerializerElement& objectElement = element.GetChild(i);
@@ -65,25 +66,13 @@ void ObjectsContainer::UnserializeObjectsFrom(
 }
 
 bool ObjectsContainer::HasObjectNamed(const gd::String& name) const {
-  return (find_if(initialObjects.begin(),
-                  initialObjects.end(),
-                  [&](const std::unique_ptr<gd::Object>& object) {
-                    return object->GetName() == name;
-                  }) != initialObjects.end());
+  return GetObjectPosition(name) != gd::String::npos;
 }
 gd::Object& ObjectsContainer::GetObject(const gd::String& name) {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *initialObjects[GetObjectPosition(name)];
 }
 const gd::Object& ObjectsContainer::GetObject(const gd::String& name) const {
-  return *(*find_if(initialObjects.begin(),
-                    initialObjects.end(),
-                    [&](const std::unique_ptr<gd::Object>& object) {
-                      return object->GetName() == name;
-                    }));
+  return *initialObjects[GetObjectPosition(name)];
 }
 gd::Object& ObjectsContainer::GetObject(std::size_t index) {
   return *initialObjects[index];
@@ -92,10 +81,9 @@ const gd::Object& ObjectsContainer::GetObject(std::size_t index) const {
   return *initialObjects[index];
 }
 std::size_t ObjectsContainer::GetObjectPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < initialObjects.size(); ++i) {
-    if (initialObjects[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return initialObjectsIndex.Find(
+      initialObjects, name, [](const std::unique_ptr<gd::Object>& object)
+          -> const gd::String& { return object->GetName(); });
 }
 std::size_t ObjectsContainer::GetObjectsCount() const {
   return initialObjects.size();
@@ -104,10 +92,11 @@ gd::Object& ObjectsContainer::InsertNewObject(const gd::Project& project,
                                               const gd::String& objectType,
                                               const gd::String& name,
                                               std::size_t position) {
+  if (position > initialObjects.size()) position = initialObjects.size();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
-      position < initialObjects.size() ? initialObjects.begin() + position
-                                       : initialObjects.end(),
+      initialObjects.begin() + position,
       project.CreateObject(objectType, name))));
+  initialObjectsIndex.Add(initialObjects, position, name);
 
   rootFolder->InsertObject(&newlyCreatedObject);
 
@@ -122,6 +111,7 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
     std::size_t position) {
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
       initialObjects.end(), project.CreateObject(objectType, name))));
+  initialObjectsIndex.Add(initialObjects, initialObjects.size() - 1, name);
 
   objectFolderOrObject.InsertObject(&newlyCreatedObject, position);
 
@@ -130,10 +120,11 @@ gd::Object& ObjectsContainer::InsertNewObjectInFolder(
 
 gd::Object& ObjectsContainer::InsertObject(const gd::Object& object,
                                            std::size_t position) {
+  if (position > initialObjects.size()) position = initialObjects.size();
   gd::Object& newlyCreatedObject = *(*(initialObjects.insert(
-      position < initialObjects.size() ? initialObjects.begin() + position
-                                       : initialObjects.end(),
+      initialObjects.begin() + position,
       std::unique_ptr<gd::Object>(object.Clone()))));
+  initialObjectsIndex.Add(initialObjects, position, object.GetName());
 
   return newlyCreatedObject;
 }
@@ -145,20 +136,17 @@ void ObjectsContainer::MoveObject(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Object> object = std::move(initialObjects[oldIndex]);
   initialObjects.erase(initialObjects.begin() + oldIndex);
   initialObjects.insert(initialObjects.begin() + newIndex, std::move(object));
+  initialObjectsIndex.Invalidate();
 }
 
 void ObjectsContainer::RemoveObject(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Object>>::iterator objectIt =
-      find_if(initialObjects.begin(),
-              initialObjects.end(),
-              [&](const std::unique_ptr<gd::Object>& object) {
-                return object->GetName() == name;
-              });
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position = GetObjectPosition(name);
+  if (position == gd::String::npos) return;
 
   rootFolder->RemoveRecursivelyObjectNamed(name);
 
-  initialObjects.erase(objectIt);
+  initialObjects.erase(initialObjects.begin() + position);
+  initialObjectsIndex.Invalidate();
 }
 
 void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
@@ -168,18 +156,19 @@ void ObjectsContainer::MoveObjectFolderOrObjectToAnotherContainerInFolder(
     std::size_t newPosition) {
   if (objectFolderOrObject.IsFolder() || !newParentFolder.IsFolder()) return;
 
-  std::vector<std::unique_ptr<gd::Object>>::iterator objectIt = find_if(
-      initialObjects.begin(),
-      initialObjects.end(),
-      [&objectFolderOrObject](std::unique_ptr<gd::Object>& object) {
-        return object->GetName() == objectFolderOrObject.GetObject().GetName();
-      });
-  if (objectIt == initialObjects.end()) return;
+  std::size_t position =
+      GetObjectPosition(objectFolderOrObject.GetObject().GetName());
+  if (position == gd::String::npos) return;
 
-  std::unique_ptr<gd::Object> object = std::move(*objectIt);
-  initialObjects.erase(objectIt);
+  std::unique_ptr<gd::Object> object = std::move(initialObjects[position]);
+  initialObjects.erase(initialObjects.begin() + position);
+  initialObjectsIndex.Invalidate();
 
+  const gd::String& name = object->GetName();
   newContainer.initialObjects.push_back(std::move(object));
+  newContainer.initialObjectsIndex.Add(newContainer.initialObjects,
+                                       newContainer.initialObjects.size() - 1,
+                                       name);
 
   objectFolderOrObject.GetParent().MoveObjectFolderOrObjectToAnotherFolder(
       objectFolderOrObject, newParentFolder, newPosition);
@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 #include "GDCore/Project/ObjectGroupsContainer.h"
 #include "GDCore/Project/ObjectFolderOrObject.h"
 namespace gd {
@@ -226,6 +227,8 @@ class GD_CORE_API ObjectsContainer {
  protected:
   std::vector<std::unique_ptr<gd::Object> >
       initialObjects;  ///< Objects contained.
+  gd::NameIndex initialObjectsIndex;  ///< Must be invalidated when
+                                      ///< initialObjects is changed.
   gd::ObjectGroupsContainer objectGroups;
 
  private:
@@ -262,27 +262,22 @@ bool Project::RemovePlatform(const gd::String& platformName) {
 }
 
 bool Project::HasLayoutNamed(const gd::String& name) const {
-  return (find_if(scenes.begin(),
-                  scenes.end(),
-                  bind2nd(gd::LayoutHasName(), name)) != scenes.end());
+  return GetLayoutPosition(name) != gd::String::npos;
 }
 gd::Layout& Project::GetLayout(const gd::String& name) {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  return *scenes[GetLayoutPosition(name)];
 }
 const gd::Layout& Project::GetLayout(const gd::String& name) const {
-  return *(*find_if(
-      scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name)));
+  return *scenes[GetLayoutPosition(name)];
 }
 gd::Layout& Project::GetLayout(std::size_t index) { return *scenes[index]; }
 const gd::Layout& Project::GetLayout(std::size_t index) const {
   return *scenes[index];
 }
 std::size_t Project::GetLayoutPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < scenes.size(); ++i) {
-    if (scenes[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return scenesIndex.Find(
+      scenes, name, [](const std::unique_ptr<gd::Layout>& layout)
+          -> const gd::String& { return layout->GetName(); });
 }
 std::size_t Project::GetLayoutsCount() const { return scenes.size(); }
 
@@ -290,15 +285,17 @@ void Project::SwapLayouts(std::size_t first, std::size_t second) {
   if (first >= scenes.size() || second >= scenes.size()) return;
 
   std::iter_swap(scenes.begin() + first, scenes.begin() + second);
+  scenesIndex.Invalidate();
 }
 
 gd::Layout& Project::InsertNewLayout(const gd::String& name,
                                      std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout())));
+  if (position > scenes.size()) position = scenes.size();
+  gd::Layout& newlyInsertedLayout =
+      *(*(scenes.emplace(scenes.begin() + position, new Layout())));
 
   newlyInsertedLayout.SetName(name);
+  scenesIndex.Add(scenes, position, name);
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 
   return newlyInsertedLayout;
@@ -306,9 +303,10 @@ gd::Layout& Project::InsertNewLayout(const gd::String& name,
 
 gd::Layout& Project::InsertLayout(const gd::Layout& layout,
                                   std::size_t position) {
-  gd::Layout& newlyInsertedLayout = *(*(scenes.emplace(
-      position < scenes.size() ? scenes.begin() + position : scenes.end(),
-      new Layout(layout))));
+  if (position > scenes.size()) position = scenes.size();
+  gd::Layout& newlyInsertedLayout =
+      *(*(scenes.emplace(scenes.begin() + position, new Layout(layout))));
+  scenesIndex.Add(scenes, position, layout.GetName());
 
   newlyInsertedLayout.UpdateBehaviorsSharedData(*this);
 
@@ -316,11 +314,11 @@ gd::Layout& Project::InsertLayout(const gd::Layout& layout,
 }
 
 void Project::RemoveLayout(const gd::String& name) {
-  std::vector<std::unique_ptr<gd::Layout> >::iterator scene =
-      find_if(scenes.begin(), scenes.end(), bind2nd(gd::LayoutHasName(), name));
-  if (scene == scenes.end()) return;
+  std::size_t position = GetLayoutPosition(name);
+  if (position == gd::String::npos) return;
 
-  scenes.erase(scene);
+  scenes.erase(scenes.begin() + position);
+  scenesIndex.Invalidate();
 }
 
 bool Project::HasExternalEventsNamed(const gd::String& name) const {
@@ -394,6 +392,7 @@ void Project::MoveLayout(std::size_t oldIndex, std::size_t newIndex) {
   std::unique_ptr<gd::Layout> scene = std::move(scenes[oldIndex]);
   scenes.erase(scenes.begin() + oldIndex);
   scenes.insert(scenes.begin() + newIndex, std::move(scene));
+  scenesIndex.Invalidate();
 };
 
 void Project::MoveExternalEvents(std::size_t oldIndex, std::size_t newIndex) {
@@ -847,6 +846,7 @@ void Project::UnserializeFrom(const SerializerElement& element) {
   GetVariables().UnserializeFrom(element.GetChild("variables", 0, "Variables"));
 
   scenes.clear();
+  scenesIndex.Invalidate();
   const SerializerElement& layoutsElement =
       element.GetChild("layouts", 0, "Scenes");
   layoutsElement.ConsiderAsArrayOf("layout", "Scene");
@@ -901,6 +901,9 @@ void Project::UnserializeFrom(const SerializerElement& element) {
 }
 
 void Project::SerializeTo(SerializerElement& element) const {
+  // The project is a large tree of elements: allocate them all at once.
+  element.UseArenaAllocation();
+
   SerializerElement& versionElement = element.AddChild("gdVersion");
   versionElement.SetAttribute("major", gd::VersionWrapper::Major());
   versionElement.SetAttribute("minor", gd::VersionWrapper::Minor());
@@ -1177,8 +1180,10 @@ void Project::Init(const gd::Project& game) {
   resourcesManager = game.resourcesManager;
 
   initialObjects = gd::Clone(game.initialObjects);
+  initialObjectsIndex.Invalidate();
 
   scenes = gd::Clone(game.scenes);
+  scenesIndex.Invalidate();
 
   externalEvents = gd::Clone(game.externalEvents);
 
@@ -635,6 +635,8 @@ class GD_CORE_API Project : public ObjectsContainer {
    * \brief Serialize the project.
    *
    * "Dirty" flag is set to false when serialization is done.
+   * The element children are allocated from an arena (see
+   * gd::SerializerElement::UseArenaAllocation).
    */
   void SerializeTo(SerializerElement& element) const;
 
@@ -1084,6 +1086,7 @@ class GD_CORE_API Project : public ObjectsContainer {
                                           ///< found on the layer at the scene
                                           ///< startup.
   std::vector<std::unique_ptr<gd::Layout> > scenes;  ///< List of all scenes
+  gd::NameIndex scenesIndex;  ///< Must be invalidated when scenes is changed.
   gd::VariablesContainer variables;  ///< Initial global variables
   std::vector<std::unique_ptr<gd::ExternalLayout> >
       externalLayouts;  ///< List of all externals layouts
@@ -37,6 +37,12 @@ gd::String ResourcesManager::badResourceName;
 ResourceFolder ResourcesManager::badFolder;
 Resource ResourceFolder::badResource;
 
+namespace {
+const gd::String& GetResourceName(const std::shared_ptr<Resource>& resource) {
+  return resource->GetName();
+}
+}  // namespace
+
 void ResourceFolder::Init(const ResourceFolder& other) {
   name = other.name;
 
@@ -48,6 +54,7 @@ void ResourceFolder::Init(const ResourceFolder& other) {
 
 void ResourcesManager::Init(const ResourcesManager& other) {
   resources.clear();
+  resourcesIndex.Invalidate();
   for (std::size_t i = 0; i < other.resources.size(); ++i) {
     resources.push_back(std::shared_ptr<Resource>(other.resources[i]->Clone()));
   }
@@ -58,17 +65,15 @@ void ResourcesManager::Init(const ResourcesManager& other) {
 }
 
 Resource& ResourcesManager::GetResource(const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
 
 const Resource& ResourcesManager::GetResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return *resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position != gd::String::npos) return *resources[position];
 
   return badResource;
 }
@@ -103,11 +108,7 @@ std::shared_ptr<Resource> ResourcesManager::CreateResource(
 }
 
 bool ResourcesManager::HasResource(const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return true;
-  }
-
-  return false;
+  return GetResourcePosition(name) != gd::String::npos;
 }
 
 const gd::String& ResourcesManager::GetResourceNameWithOrigin(
@@ -229,6 +230,7 @@ bool ResourcesManager::AddResource(const gd::Resource& resource) {
   if (newResource == std::shared_ptr<Resource>()) return false;
 
   resources.push_back(newResource);
+  resourcesIndex.Add(resources, resources.size() - 1, newResource->GetName());
   return true;
 }
 
@@ -242,6 +244,7 @@ bool ResourcesManager::AddResource(const gd::String& name,
   res->SetName(name);
 
   resources.push_back(res);
+  resourcesIndex.Add(resources, resources.size() - 1, name);
 
   return true;
 }
@@ -318,19 +321,18 @@ bool ResourceFolder::MoveResourceDownInList(const gd::String& name) {
 }
 
 bool ResourcesManager::MoveResourceUpInList(const gd::String& name) {
+  resourcesIndex.Invalidate();
   return gd::MoveResourceUpInList(resources, name);
 }
 
 bool ResourcesManager::MoveResourceDownInList(const gd::String& name) {
+  resourcesIndex.Invalidate();
   return gd::MoveResourceDownInList(resources, name);
 }
 
 std::size_t ResourcesManager::GetResourcePosition(
     const gd::String& name) const {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return i;
-  }
-  return gd::String::npos;
+  return resourcesIndex.Find(resources, name, GetResourceName);
 }
 
 void ResourcesManager::MoveResource(std::size_t oldIndex,
@@ -340,6 +342,7 @@ void ResourcesManager::MoveResource(std::size_t oldIndex,
   auto resource = resources[oldIndex];
   resources.erase(resources.begin() + oldIndex);
   resources.insert(resources.begin() + newIndex, resource);
+  resourcesIndex.Invalidate();
 }
 
 bool ResourcesManager::MoveFolderUpInList(const gd::String& name) {
@@ -366,9 +369,8 @@ bool ResourcesManager::MoveFolderDownInList(const gd::String& name) {
 
 std::shared_ptr<gd::Resource> ResourcesManager::GetResourceSPtr(
     const gd::String& name) {
-  for (std::size_t i = 0; i < resources.size(); ++i) {
-    if (resources[i]->GetName() == name) return resources[i];
-  }
+  std::size_t position = GetResourcePosition(name);
+  if (position != gd::String::npos) return resources[position];
 
   return std::shared_ptr<gd::Resource>();
 }
@@ -441,6 +443,7 @@ void ResourcesManager::RenameResource(const gd::String& oldName,
   for (std::size_t i = 0; i < resources.size(); ++i) {
     if (resources[i]->GetName() == oldName) resources[i]->SetName(newName);
   }
+  resourcesIndex.Invalidate();
 }
 
 void ResourceFolder::RemoveResource(const gd::String& name) {
@@ -461,6 +464,7 @@ void ResourcesManager::RemoveResource(const gd::String& name) {
     else
       ++i;
   }
+  resourcesIndex.Invalidate();
 
   for (std::size_t i = 0; i < folders.size(); ++i)
     folders[i].RemoveResource(name);
@@ -493,6 +497,7 @@ void ResourceFolder::SerializeTo(SerializerElement& element) const {
 
 void ResourcesManager::UnserializeFrom(const SerializerElement& element) {
   resources.clear();
+  resourcesIndex.Invalidate();
   const SerializerElement& resourcesElement =
       element.GetChild("resources", 0, "Resources");
   resourcesElement.ConsiderAsArrayOf("resource", "Resource");
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class Project;
 class ResourceFolder;
@@ -32,7 +33,10 @@ class GD_CORE_API Resource {
 
   /** \brief Change the name of the resource with the name passed as parameter.
    */
-  virtual void SetName(const gd::String& name_) { name = name_; }
+  virtual void SetName(const gd::String& name_) {
+    if (!name.empty() && name != name_) gd::NameIndex::NotifyNameChanged();
+    name = name_;
+  }
 
   /** \brief Return the name of the resource.
    */
@@ -717,6 +721,8 @@ class GD_CORE_API ResourcesManager {
   void Init(const ResourcesManager& other);
 
   std::vector<std::shared_ptr<Resource> > resources;
+  gd::NameIndex resourcesIndex;  ///< Must be invalidated when resources is
+                                 ///< changed.
   std::vector<ResourceFolder> folders;
 
   static ResourceFolder badFolder;
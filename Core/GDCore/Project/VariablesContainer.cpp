@@ -21,6 +21,11 @@ gd::String VariablesContainer::badName;
 
 namespace {
 
+const gd::String& GetVariableName(
+    const std::pair<gd::String, std::shared_ptr<gd::Variable>>& p) {
+  return p.first;
+}
+
 // Tool functor used below
 class VariableHasName {
  public:
@@ -38,23 +43,19 @@ class VariableHasName {
 VariablesContainer::VariablesContainer() {}
 
 bool VariablesContainer::Has(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  return (i != variables.end());
+  return GetPosition(name) != gd::String::npos;
 }
 
 Variable& VariablesContainer::Get(const gd::String& name) {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = GetPosition(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
 
 const Variable& VariablesContainer::Get(const gd::String& name) const {
-  auto i =
-      std::find_if(variables.begin(), variables.end(), VariableHasName(name));
-  if (i != variables.end()) return *i->second;
+  std::size_t position = GetPosition(name);
+  if (position != gd::String::npos) return *variables[position].second;
 
   return badVariable;
 }
@@ -84,9 +85,11 @@ Variable& VariablesContainer::Insert(const gd::String& name,
   if (position < variables.size()) {
     variables.insert(variables.begin() + position,
                      std::make_pair(name, newVariable));
+    variablesIndex.Invalidate();
     return *variables[position].second;
   } else {
     variables.push_back(std::make_pair(name, newVariable));
+    variablesIndex.Add(variables, variables.size() - 1, name);
     return *variables.back().second;
   }
 }
@@ -96,6 +99,7 @@ void VariablesContainer::Remove(const gd::String& varName) {
       std::remove_if(
           variables.begin(), variables.end(), VariableHasName(varName)),
       variables.end());
+  variablesIndex.Invalidate();
 }
 
 void VariablesContainer::RemoveRecursively(
@@ -110,6 +114,7 @@ void VariablesContainer::RemoveRecursively(
             return &variableToRemove == nameAndVariable.second.get();
           }),
       variables.end());
+  variablesIndex.Invalidate();
 
   for (auto& it : variables) {
     it.second->RemoveRecursively(variableToRemove);
@@ -117,11 +122,7 @@ void VariablesContainer::RemoveRecursively(
 }
 
 std::size_t VariablesContainer::GetPosition(const gd::String& name) const {
-  for (std::size_t i = 0; i < variables.size(); ++i) {
-    if (variables[i].first == name) return i;
-  }
-
-  return gd::String::npos;
+  return variablesIndex.Find(variables, name, GetVariableName);
 }
 
 Variable& VariablesContainer::InsertNew(const gd::String& name,
@@ -134,9 +135,11 @@ bool VariablesContainer::Rename(const gd::String& oldName,
                                 const gd::String& newName) {
   if (Has(newName)) return false;
 
-  auto i = std::find_if(
-      variables.begin(), variables.end(), VariableHasName(oldName));
-  if (i != variables.end()) i->first = newName;
+  std::size_t position = GetPosition(oldName);
+  if (position != gd::String::npos) {
+    variables[position].first = newName;
+    variablesIndex.Invalidate();
+  }
 
   return true;
 }
@@ -150,6 +153,7 @@ void VariablesContainer::Swap(std::size_t firstVariableIndex,
   auto temp = variables[firstVariableIndex];
   variables[firstVariableIndex] = variables[secondVariableIndex];
   variables[secondVariableIndex] = temp;
+  variablesIndex.Invalidate();
 }
 
 void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
@@ -160,6 +164,7 @@ void VariablesContainer::Move(std::size_t oldIndex, std::size_t newIndex) {
   auto nameAndVariable = variables[oldIndex];
   variables.erase(variables.begin() + oldIndex);
   variables.insert(variables.begin() + newIndex, nameAndVariable);
+  variablesIndex.Invalidate();
 }
 
 void VariablesContainer::ForEachVariableMatchingSearch(
@@ -231,6 +236,7 @@ VariablesContainer& VariablesContainer::operator=(
 void VariablesContainer::Init(const gd::VariablesContainer& other) {
   persistentUuid = other.persistentUuid;
   variables.clear();
+  variablesIndex.Invalidate();
   for (auto& it : other.variables) {
     variables.push_back(
         std::make_pair(it.first, std::make_shared<gd::Variable>(*it.second)));
@@ -10,6 +10,7 @@
 #include <vector>
 #include "GDCore/Project/Variable.h"
 #include "GDCore/String.h"
+#include "GDCore/Tools/NameIndex.h"
 namespace gd {
 class SerializerElement;
 }
@@ -136,7 +137,10 @@ class GD_CORE_API VariablesContainer {
   /**
    * \brief Clear all variables of the container.
    */
-  inline void Clear() { variables.clear(); }
+  inline void Clear() {
+    variables.clear();
+    variablesIndex.Invalidate();
+  }
 
   /**
    * \brief Call the callback for each variable with a name matching the specified search.
@@ -179,6 +183,8 @@ class GD_CORE_API VariablesContainer {
 
  private:
   std::vector<std::pair<gd::String, std::shared_ptr<gd::Variable>>> variables;
+  gd::NameIndex variablesIndex;  ///< Must be invalidated when variables is
+                                 ///< changed.
   mutable gd::String persistentUuid;  ///< A persistent random version 4 UUID,
                                       ///< useful for computing changesets.
   static gd::Variable badVariable;
@@ -0,0 +1,183 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/BinarySerializer.h"
+
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+
+#include "GDCore/Serialization/BinarySerializerReader.h"
+
+namespace gd {
+
+namespace {
+class BinaryWriter {
+ public:
+  BinaryWriter(std::vector<char>& output_) : output(output_){};
+
+  void WriteUInt8(std::uint8_t value) { output.push_back((char)value); }
+  void WriteUInt32(std::uint32_t value) {
+    for (int i = 0; i < 4; ++i)
+      output.push_back((char)((value >> (i * 8)) & 0xFF));
+  }
+  void WriteUInt64(std::uint64_t value) {
+    for (int i = 0; i < 8; ++i)
+      output.push_back((char)((value >> (i * 8)) & 0xFF));
+  }
+  void WriteDouble(double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteUInt64(bits);
+  }
+  void WriteString(const std::string& value) {
+    WriteUInt32(value.size());
+    output.insert(output.end(), value.begin(), value.end());
+  }
+
+  /**
+   * \brief Reserve space for an uint32 to be written later with PatchUInt32.
+   */
+  std::size_t ReserveUInt32() {
+    std::size_t position = output.size();
+    WriteUInt32(0);
+    return position;
+  }
+  void PatchUInt32(std::size_t position, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i)
+      output[position + i] = (char)((value >> (i * 8)) & 0xFF);
+  }
+
+  std::size_t GetSize() const { return output.size(); }
+
+ private:
+  std::vector<char>& output;
+};
+
+class KeysTable {
+ public:
+  std::uint32_t GetIndex(const gd::String& key) {
+    auto it = indices.find(key);
+    if (it != indices.end()) return it->second;
+
+    std::uint32_t index = keys.size();
+    keys.push_back(&key);
+    indices[key] = index;
+    return index;
+  }
+
+  void CollectKeys(const SerializerElement& element) {
+    if (element.ConsideredAsArray()) GetIndex(element.ConsideredAsArrayOf());
+    for (const auto& attribute : element.GetAllAttributes())
+      GetIndex(attribute.first);
+    for (const auto& child : element.GetAllChildren()) {
+      if (!child.second) continue;
+      GetIndex(child.first);
+      CollectKeys(*child.second);
+    }
+  }
+
+  const std::vector<const gd::String*>& GetKeys() const { return keys; }
+
+ private:
+  std::vector<const gd::String*> keys;
+  std::unordered_map<gd::String, std::uint32_t> indices;
+};
+
+std::uint8_t GetValueType(const SerializerValue& value) {
+  if (value.IsBoolean()) return BinarySerializer::Boolean;
+  if (value.IsInt()) return BinarySerializer::Int;
+  if (value.IsDouble()) return BinarySerializer::Double;
+  if (value.IsString()) return BinarySerializer::String;
+  return BinarySerializer::Unknown;
+}
+
+void WriteValue(BinaryWriter& writer,
+                std::uint8_t valueType,
+                const SerializerValue& value) {
+  if (valueType == BinarySerializer::Boolean)
+    writer.WriteUInt8(value.GetBool() ? 1 : 0);
+  else if (valueType == BinarySerializer::Int)
+    writer.WriteUInt32((std::uint32_t)value.GetInt());
+  else if (valueType == BinarySerializer::Double)
+    writer.WriteDouble(value.GetDouble());
+  else if (valueType == BinarySerializer::String)
+    writer.WriteString(value.GetRawString().Raw());
+  else if (valueType == BinarySerializer::Unknown)
+    writer.WriteString(value.GetString().Raw());
+}
+
+void WriteElement(BinaryWriter& writer,
+                  KeysTable& keysTable,
+                  const SerializerElement& element) {
+  // Only read the value if defined: otherwise GetValue would return the
+  // "value" attribute, which is already written with the other attributes.
+  std::uint8_t valueType = element.IsValueUndefined()
+                               ? BinarySerializer::Undefined
+                               : GetValueType(element.GetValue());
+  std::uint8_t flags = valueType;
+  if (element.ConsideredAsArray()) flags |= BinarySerializer::ArrayFlag;
+
+  writer.WriteUInt8(flags);
+  if (valueType != BinarySerializer::Undefined)
+    WriteValue(writer, valueType, element.GetValue());
+  if (element.ConsideredAsArray())
+    writer.WriteUInt32(keysTable.GetIndex(element.ConsideredAsArrayOf()));
+
+  const auto& attributes = element.GetAllAttributes();
+  writer.WriteUInt32(attributes.size());
+  for (const auto& attribute : attributes) {
+    std::uint8_t attributeType = GetValueType(attribute.second);
+    writer.WriteUInt32(keysTable.GetIndex(attribute.first));
+    writer.WriteUInt8(attributeType);
+    WriteValue(writer, attributeType, attribute.second);
+  }
+
+  const auto& children = element.GetAllChildren();
+  std::size_t childrenCountPosition = writer.ReserveUInt32();
+  std::uint32_t childrenCount = 0;
+  for (const auto& child : children) {
+    if (!child.second) continue;
+
+    writer.WriteUInt32(keysTable.GetIndex(child.first));
+    std::size_t childSizePosition = writer.ReserveUInt32();
+    std::size_t childStart = writer.GetSize();
+    WriteElement(writer, keysTable, *child.second);
+    writer.PatchUInt32(childSizePosition, writer.GetSize() - childStart);
+    childrenCount++;
+  }
+  writer.PatchUInt32(childrenCountPosition, childrenCount);
+}
+}  // namespace
+
+std::vector<char> BinarySerializer::ToBinary(const SerializerElement& element) {
+  KeysTable keysTable;
+  keysTable.CollectKeys(element);
+
+  std::vector<char> output;
+  BinaryWriter writer(output);
+  output.insert(output.end(), {'G', 'D', 'S', 'B'});
+  writer.WriteUInt32(Version);
+  writer.WriteUInt32(keysTable.GetKeys().size());
+  for (const gd::String* key : keysTable.GetKeys())
+    writer.WriteString(key->Raw());
+
+  WriteElement(writer, keysTable, element);
+  return output;
+}
+
+SerializerElement BinarySerializer::FromBinary(const char* data,
+                                               std::size_t size) {
+  BinarySerializerReader reader(data, size);
+  if (!reader.IsValid()) {
+    std::cout << "Error while reading binary serialized data: invalid header."
+              << std::endl;
+    return SerializerElement();
+  }
+
+  return reader.GetRootElement().ToSerializerElement();
+}
+
+}  // namespace gd
@@ -0,0 +1,157 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_BINARYSERIALIZER_H
+#define GDCORE_BINARYSERIALIZER_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "GDCore/Serialization/SerializerElement.h"
+
+namespace gd {
+
+/**
+ * \brief Convert a gd::SerializerElement from/to a compact binary format,
+ * faster to read than JSON.
+ *
+ * This is useful to keep snapshots of a project in memory or on disk (undo,
+ * autosave, hot-reload...). Use gd::BinarySerializerReader to read an element
+ * from the binary data without decoding the whole tree.
+ *
+ * The format is (all numbers are little endian):
+ * - a header: the "GDSB" magic, the version as an uint32, then the table of
+ * all the names of children/attributes (uint32 count, then for each name its
+ * uint32 size followed by its UTF8 bytes). Names are then referred to by their
+ * uint32 index in this table.
+ * - the root element, each element being made of:
+ *   - an uint8 of flags: the type of the value in the 3 lowest bits (see
+ * gd::BinarySerializer::ValueType) and gd::BinarySerializer::ArrayFlag if
+ * the element is considered as an array,
+ *   - the value, if any (uint8 for booleans, int32 for integers, 8 bytes for
+ * doubles, uint32 size followed by the UTF8 bytes for strings),
+ *   - the name index of the array children, if the element is an array,
+ *   - the uint32 count of attributes, then for each the name index, the uint8
+ * type of the value and the value,
+ *   - the uint32 count of children, then for each the name index, the uint32
+ * size in bytes of the child and the child element itself (so that a child can
+ * be skipped without being read).
+ *
+ * \see gd::Serializer
+ * \see gd::BinarySerializerReader
+ */
+class GD_CORE_API BinarySerializer {
+ public:
+  /**
+   * \brief The type of a value, as stored in the binary format.
+   */
+  enum ValueType {
+    Undefined = 0,
+    Boolean = 1,
+    Int = 2,
+    Double = 3,
+    String = 4,
+    Unknown = 5,  ///< A value of unknown type, stored as a string.
+  };
+
+  static constexpr std::uint8_t ValueTypeMask = 0x07;
+  static constexpr std::uint8_t ArrayFlag = 0x10;
+  static constexpr std::uint32_t Version = 1;
+
+  /**
+   * \brief Serialize a gd::SerializerElement to the binary format.
+   */
+  static std::vector<char> ToBinary(const SerializerElement& element);
+
+  /**
+   * \brief Construct a gd::SerializerElement from binary data.
+   *
+   * If the data is not valid, the error is logged and an empty element is
+   * returned.
+   */
+  static SerializerElement FromBinary(const char* data, std::size_t size);
+
+  /**
+   * \brief Construct a gd::SerializerElement from binary data.
+   */
+  static SerializerElement FromBinary(const std::vector<char>& data) {
+    return FromBinary(data.data(), data.size());
+  }
+
+  virtual ~BinarySerializer(){};
+
+ private:
+  BinarySerializer(){};
+};
+
+/**
+ * \brief A buffer of data in the binary format of gd::BinarySerializer, which
+ * memory can be read or written directly.
+ *
+ * This allows to transfer a whole gd::SerializerElement at once to/from
+ * JavaScript, reading or writing the buffer in the memory of the WebAssembly
+ * module, instead of using the bindings for each element and value.
+ *
+ * \see gd::BinarySerializer
+ */
+class GD_CORE_API BinarySerializerBuffer {
+ public:
+  BinarySerializerBuffer(){};
+  virtual ~BinarySerializerBuffer(){};
+
+  /**
+   * \brief Serialize the element into the buffer, replacing its content.
+   */
+  void Serialize(const SerializerElement& element) {
+    data = BinarySerializer::ToBinary(element);
+  };
+
+  /**
+   * \brief Construct a gd::SerializerElement from the content of the buffer.
+   */
+  SerializerElement Unserialize() const {
+    return BinarySerializer::FromBinary(data);
+  };
+
+  /**
+   * \brief Replace the content of the element by the content of the buffer.
+   */
+  void UnserializeTo(SerializerElement& element) const {
+    element = BinarySerializer::FromBinary(data);
+  };
+
+  /**
+   * \brief Resize the buffer, for example before writing data in it.
+   */
+  void Resize(std::size_t size) { data.resize(size); };
+
+  /**
+   * \brief Return the size, in bytes, of the content of the buffer.
+   */
+  std::size_t GetSize() const { return data.size(); };
+
+  /**
+   * \brief Return the content of the buffer.
+   */
+  const std::vector<char>& GetData() const { return data; };
+
+  /**
+   * \brief Return the address of the content of the buffer in memory.
+   *
+   * \warning The address changes when the buffer is resized or serialized
+   * again.
+   */
+  std::size_t GetDataAddress() const {
+    return reinterpret_cast<std::size_t>(data.data());
+  };
+
+ private:
+  std::vector<char> data;
+};
+
+}  // namespace gd
+
+#endif
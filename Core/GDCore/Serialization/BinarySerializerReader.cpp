@@ -0,0 +1,395 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/BinarySerializerReader.h"
+
+#include <cstring>
+
+#include "GDCore/Serialization/BinarySerializer.h"
+
+namespace gd {
+
+gd::String BinarySerializerReader::badKey;
+
+namespace {
+/**
+ * \brief Read numbers and strings from the data, checking that nothing is
+ * read outside of it.
+ */
+class BinaryCursor {
+ public:
+  BinaryCursor(const char* data_, std::size_t position_, std::size_t end_)
+      : data(data_), position(position_), end(end_), ok(true){};
+
+  std::uint8_t ReadUInt8() {
+    if (!Require(1)) return 0;
+    return (std::uint8_t)data[position++];
+  }
+  std::uint32_t ReadUInt32() {
+    if (!Require(4)) return 0;
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+      value |= (std::uint32_t)(std::uint8_t)data[position++] << (i * 8);
+    return value;
+  }
+  double ReadDouble() {
+    if (!Require(8)) return 0;
+    std::uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i)
+      bits |= (std::uint64_t)(std::uint8_t)data[position++] << (i * 8);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+  gd::String ReadString() {
+    std::uint32_t length = ReadUInt32();
+    if (!Require(length)) return "";
+    gd::String value;
+    value.Raw().assign(data + position, length);
+    position += length;
+    return value;
+  }
+  void Skip(std::size_t length) {
+    if (Require(length)) position += length;
+  }
+
+  /**
+   * \brief Skip a value of the given type.
+   */
+  void SkipValue(std::uint8_t valueType) {
+    if (valueType == BinarySerializer::Boolean)
+      Skip(1);
+    else if (valueType == BinarySerializer::Int)
+      Skip(4);
+    else if (valueType == BinarySerializer::Double)
+      Skip(8);
+    else if (valueType == BinarySerializer::String ||
+             valueType == BinarySerializer::Unknown)
+      Skip(ReadUInt32());
+    else if (valueType != BinarySerializer::Undefined)
+      ok = false;
+  }
+
+  /**
+   * \brief Read a value of the given type.
+   */
+  SerializerValue ReadValue(std::uint8_t valueType) {
+    SerializerValue value;
+    if (valueType == BinarySerializer::Boolean)
+      value.SetBool(ReadUInt8() != 0);
+    else if (valueType == BinarySerializer::Int)
+      value.SetInt((int)ReadUInt32());
+    else if (valueType == BinarySerializer::Double)
+      value.SetDouble(ReadDouble());
+    else if (valueType == BinarySerializer::String)
+      value.SetString(ReadString());
+    else if (valueType == BinarySerializer::Unknown)
+      value.Set(ReadString());
+    else
+      ok = false;
+
+    return value;
+  }
+
+  std::size_t GetPosition() const { return position; }
+  bool IsOk() const { return ok; }
+
+ private:
+  bool Require(std::size_t length) {
+    if (!ok || end - position < length) ok = false;
+    return ok;
+  }
+
+  const char* data;
+  std::size_t position;
+  std::size_t end;
+  bool ok;
+};
+}  // namespace
+
+BinarySerializerReader::BinarySerializerReader(const char* data_,
+                                               std::size_t size_)
+    : data(data_), size(size_), valid(false), rootOffset(0) {
+  if (!data || size < 4 || std::memcmp(data, "GDSB", 4) != 0) return;
+
+  BinaryCursor cursor(data, 4, size);
+  if (cursor.ReadUInt32() != BinarySerializer::Version) return;
+
+  std::uint32_t keysCount = cursor.ReadUInt32();
+  for (std::uint32_t i = 0; i < keysCount && cursor.IsOk(); ++i) {
+    keys.push_back(cursor.ReadString());
+    keysIndices[keys.back()] = i;
+  }
+  if (!cursor.IsOk()) return;
+
+  rootOffset = cursor.GetPosition();
+  valid = true;
+}
+
+BinarySerializedElement BinarySerializerReader::GetRootElement() const {
+  if (!valid) return BinarySerializedElement();
+  return BinarySerializedElement(*this, rootOffset, size - rootOffset);
+}
+
+std::int64_t BinarySerializerReader::GetKeyIndex(const gd::String& name) const {
+  auto it = keysIndices.find(name);
+  return it != keysIndices.end() ? it->second : -1;
+}
+
+const gd::String& BinarySerializerReader::GetKey(std::uint32_t index) const {
+  return index < keys.size() ? keys[index] : badKey;
+}
+
+BinarySerializedElement::Layout BinarySerializedElement::ReadLayout() const {
+  Layout layout;
+  layout.valid = false;
+  if (!reader) return layout;
+
+  BinaryCursor cursor(reader->GetData(), offset, offset + size);
+  layout.flags = cursor.ReadUInt8();
+  layout.valueOffset = cursor.GetPosition();
+  cursor.SkipValue(layout.flags & BinarySerializer::ValueTypeMask);
+  layout.arrayOfKey = (layout.flags & BinarySerializer::ArrayFlag)
+                          ? cursor.ReadUInt32()
+                          : (std::uint32_t)-1;
+
+  layout.attributesCount = cursor.ReadUInt32();
+  layout.attributesOffset = cursor.GetPosition();
+  for (std::uint32_t i = 0; i < layout.attributesCount && cursor.IsOk(); ++i) {
+    cursor.Skip(4);
+    cursor.SkipValue(cursor.ReadUInt8());
+  }
+
+  layout.childrenCount = cursor.ReadUInt32();
+  layout.childrenOffset = cursor.GetPosition();
+  layout.valid = cursor.IsOk();
+  return layout;
+}
+
+template <typename Fn>
+void BinarySerializedElement::ForEachChild(const Layout& layout, Fn fn) const {
+  BinaryCursor cursor(reader->GetData(), layout.childrenOffset, offset + size);
+  for (std::uint32_t i = 0; i < layout.childrenCount; ++i) {
+    std::uint32_t key = cursor.ReadUInt32();
+    std::uint32_t childSize = cursor.ReadUInt32();
+    std::size_t childOffset = cursor.GetPosition();
+    cursor.Skip(childSize);
+    if (!cursor.IsOk()) return;
+
+    if (fn(key, BinarySerializedElement(*reader, childOffset, childSize)))
+      return;
+  }
+}
+
+bool BinarySerializedElement::IsValid() const { return ReadLayout().valid; }
+
+bool BinarySerializedElement::IsValueUndefined() const {
+  Layout layout = ReadLayout();
+  return !layout.valid || (layout.flags & BinarySerializer::ValueTypeMask) ==
+                              BinarySerializer::Undefined;
+}
+
+SerializerValue BinarySerializedElement::GetValue() const {
+  Layout layout = ReadLayout();
+  if (!layout.valid) return SerializerValue();
+
+  std::uint8_t valueType = layout.flags & BinarySerializer::ValueTypeMask;
+  if (valueType == BinarySerializer::Undefined) {
+    SerializerValue value;
+    FindAttribute("value", value);
+    return value;
+  }
+
+  BinaryCursor cursor(reader->GetData(), layout.valueOffset, offset + size);
+  return cursor.ReadValue(valueType);
+}
+
+bool BinarySerializedElement::FindAttribute(const gd::String& name,
+                                            SerializerValue& value) const {
+  Layout layout = ReadLayout();
+  if (!layout.valid) return false;
+  std::int64_t key = reader->GetKeyIndex(name);
+  if (key == -1) return false;
+
+  BinaryCursor cursor(
+      reader->GetData(), layout.attributesOffset, offset + size);
+  for (std::uint32_t i = 0; i < layout.attributesCount && cursor.IsOk(); ++i) {
+    std::uint32_t attributeKey = cursor.ReadUInt32();
+    std::uint8_t attributeType = cursor.ReadUInt8();
+    if (attributeKey == key) {
+      value = cursor.ReadValue(attributeType);
+      return cursor.IsOk();
+    }
+    cursor.SkipValue(attributeType);
+  }
+
+  return false;
+}
+
+bool BinarySerializedElement::GetAttributeOrChildValue(
+    const gd::String& name, SerializerValue& value) const {
+  if (FindAttribute(name, value)) return true;
+
+  BinarySerializedElement child = GetChild(name);
+  if (!child.IsValid() || child.IsValueUndefined()) return false;
+
+  value = child.GetValue();
+  return true;
+}
+
+bool BinarySerializedElement::HasAttribute(const gd::String& name) const {
+  SerializerValue value;
+  return FindAttribute(name, value);
+}
+
+bool BinarySerializedElement::GetBoolAttribute(const gd::String& name,
+                                               bool defaultValue) const {
+  SerializerValue value;
+  return GetAttributeOrChildValue(name, value) ? value.GetBool()
+                                               : defaultValue;
+}
+
+gd::String BinarySerializedElement::GetStringAttribute(
+    const gd::String& name, gd::String defaultValue) const {
+  SerializerValue value;
+  return GetAttributeOrChildValue(name, value) ? value.GetString()
+                                               : defaultValue;
+}
+
+int BinarySerializedElement::GetIntAttribute(const gd::String& name,
+                                             int defaultValue) const {
+  SerializerValue value;
+  return GetAttributeOrChildValue(name, value) ? value.GetInt()
+                                               : defaultValue;
+}
+
+double BinarySerializedElement::GetDoubleAttribute(const gd::String& name,
+                                                   double defaultValue) const {
+  SerializerValue value;
+  return GetAttributeOrChildValue(name, value) ? value.GetDouble()
+                                               : defaultValue;
+}
+
+bool BinarySerializedElement::ConsideredAsArray() const {
+  Layout layout = ReadLayout();
+  return layout.valid && (layout.flags & BinarySerializer::ArrayFlag);
+}
+
+gd::String BinarySerializedElement::ConsideredAsArrayOf() const {
+  Layout layout = ReadLayout();
+  if (!layout.valid || !(layout.flags & BinarySerializer::ArrayFlag))
+    return "";
+
+  return reader->GetKey(layout.arrayOfKey);
+}
+
+BinarySerializedElement BinarySerializedElement::GetChild(
+    const gd::String& name, std::size_t index) const {
+  Layout layout = ReadLayout();
+  if (!layout.valid) return BinarySerializedElement();
+
+  bool isArray = layout.flags & BinarySerializer::ArrayFlag;
+  std::int64_t key =
+      isArray ? layout.arrayOfKey : reader->GetKeyIndex(name);
+  std::int64_t emptyKey = isArray ? reader->GetKeyIndex("") : -1;
+  if (key == -1 && emptyKey == -1) return BinarySerializedElement();
+
+  BinarySerializedElement result;
+  std::size_t currentIndex = 0;
+  ForEachChild(layout,
+               [&](std::uint32_t childKey, BinarySerializedElement child) {
+                 if (childKey != key && childKey != emptyKey) return false;
+                 if (currentIndex++ != index) return false;
+
+                 result = child;
+                 return true;
+               });
+  return result;
+}
+
+BinarySerializedElement BinarySerializedElement::GetChild(
+    std::size_t index) const {
+  if (!ConsideredAsArray()) return BinarySerializedElement();
+
+  return GetChild("", index);
+}
+
+std::size_t BinarySerializedElement::GetChildrenCount(
+    const gd::String& name) const {
+  Layout layout = ReadLayout();
+  if (!layout.valid) return 0;
+
+  bool isArray = layout.flags & BinarySerializer::ArrayFlag;
+  if (name.empty() && !isArray) return 0;
+
+  std::int64_t key =
+      name.empty() ? layout.arrayOfKey : reader->GetKeyIndex(name);
+  std::int64_t emptyKey = isArray ? reader->GetKeyIndex("") : -1;
+
+  std::size_t count = 0;
+  ForEachChild(layout,
+               [&](std::uint32_t childKey, BinarySerializedElement child) {
+                 if (childKey == key || childKey == emptyKey) count++;
+                 return false;
+               });
+  return count;
+}
+
+bool BinarySerializedElement::HasChild(const gd::String& name) const {
+  Layout layout = ReadLayout();
+  std::int64_t key = layout.valid ? reader->GetKeyIndex(name) : -1;
+  if (key == -1) return false;
+
+  bool found = false;
+  ForEachChild(layout,
+               [&](std::uint32_t childKey, BinarySerializedElement child) {
+                 found = childKey == key;
+                 return found;
+               });
+  return found;
+}
+
+SerializerElement BinarySerializedElement::ToSerializerElement() const {
+  SerializerElement element;
+  element.UseArenaAllocation();
+  ReadInto(element);
+  return element;
+}
+
+void BinarySerializedElement::ReadInto(SerializerElement& element) const {
+  Layout layout = ReadLayout();
+  if (!layout.valid) return;
+
+  std::uint8_t valueType = layout.flags & BinarySerializer::ValueTypeMask;
+  if (valueType != BinarySerializer::Undefined) {
+    BinaryCursor cursor(reader->GetData(), layout.valueOffset, offset + size);
+    element.SetValue(cursor.ReadValue(valueType));
+  }
+  if (layout.flags & BinarySerializer::ArrayFlag)
+    element.ConsiderAsArrayOf(reader->GetKey(layout.arrayOfKey));
+
+  BinaryCursor cursor(
+      reader->GetData(), layout.attributesOffset, offset + size);
+  for (std::uint32_t i = 0; i < layout.attributesCount && cursor.IsOk(); ++i) {
+    const gd::String& name = reader->GetKey(cursor.ReadUInt32());
+    SerializerValue value = cursor.ReadValue(cursor.ReadUInt8());
+    if (value.IsBoolean())
+      element.SetAttribute(name, value.GetBool());
+    else if (value.IsInt())
+      element.SetAttribute(name, value.GetInt());
+    else if (value.IsDouble())
+      element.SetAttribute(name, value.GetDouble());
+    else
+      element.SetAttribute(name, value.GetString());
+  }
+
+  ForEachChild(layout,
+               [&](std::uint32_t childKey, BinarySerializedElement child) {
+                 child.ReadInto(element.AddChild(reader->GetKey(childKey)));
+                 return false;
+               });
+}
+
+}  // namespace gd
@@ -0,0 +1,222 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_BINARYSERIALIZERREADER_H
+#define GDCORE_BINARYSERIALIZERREADER_H
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/SerializerValue.h"
+#include "GDCore/String.h"
+
+namespace gd {
+class BinarySerializerReader;
+}
+
+namespace gd {
+
+/**
+ * \brief A read-only view on an element stored in data produced by
+ * gd::BinarySerializer.
+ *
+ * Nothing is decoded until requested: getting a child only reads the names of
+ * the children of the element, and skips the content of the other children.
+ * The methods mirror the ones of gd::SerializerElement.
+ *
+ * \note The view is only valid as long as the gd::BinarySerializerReader
+ * (and the data it reads) is alive.
+ *
+ * \see gd::BinarySerializerReader
+ */
+class GD_CORE_API BinarySerializedElement {
+ public:
+  /**
+   * \brief Create an invalid element (like gd::SerializerElement::nullElement).
+   */
+  BinarySerializedElement() : reader(nullptr), offset(0), size(0){};
+  BinarySerializedElement(const BinarySerializerReader& reader_,
+                          std::size_t offset_,
+                          std::size_t size_)
+      : reader(&reader_), offset(offset_), size(size_){};
+
+  /**
+   * \brief Return false if the element does not exist (for example, if it's
+   * a child that was not found) or if the data is corrupted.
+   */
+  bool IsValid() const;
+
+  /** \name Value
+   */
+  ///@{
+  /**
+   * \brief Return true if no value was set for the element.
+   */
+  bool IsValueUndefined() const;
+
+  /**
+   * \brief Get the value of the element.
+   *
+   * \note As with gd::SerializerElement::GetValue, if no value was set, an
+   * attribute named "value" is searched.
+   */
+  SerializerValue GetValue() const;
+
+  bool GetBoolValue() const { return GetValue().GetBool(); };
+  gd::String GetStringValue() const { return GetValue().GetString(); };
+  int GetIntValue() const { return GetValue().GetInt(); };
+  double GetDoubleValue() const { return GetValue().GetDouble(); };
+  ///@}
+
+  /** \name Attributes
+   * Like gd::SerializerElement, the attribute getters also search in the
+   * children elements.
+   */
+  ///@{
+  bool HasAttribute(const gd::String& name) const;
+  bool GetBoolAttribute(const gd::String& name,
+                        bool defaultValue = false) const;
+  gd::String GetStringAttribute(const gd::String& name,
+                                gd::String defaultValue = "") const;
+  int GetIntAttribute(const gd::String& name, int defaultValue = 0) const;
+  double GetDoubleAttribute(const gd::String& name,
+                            double defaultValue = 0.0) const;
+  ///@}
+
+  /** \name Children
+   */
+  ///@{
+  /**
+   * \brief Check if the element is considered as an array containing its
+   * children.
+   */
+  bool ConsideredAsArray() const;
+
+  /**
+   * \brief Return the name of the children the element is considered an array
+   * of.
+   */
+  gd::String ConsideredAsArrayOf() const;
+
+  /**
+   * \brief Get a child of the element using its name.
+   * \return An invalid element if the child is not found.
+   */
+  BinarySerializedElement GetChild(const gd::String& name,
+                                   std::size_t index = 0) const;
+
+  /**
+   * \brief Get a child of the element using its index (when the element is
+   * considered as an array).
+   * \return An invalid element if the child is not found.
+   */
+  BinarySerializedElement GetChild(std::size_t index) const;
+
+  /**
+   * \brief Get the number of children having a specific name (or the number
+   * of children of the array if no name is specified).
+   */
+  std::size_t GetChildrenCount(const gd::String& name = "") const;
+
+  /**
+   * \brief Return true if the specified child exists.
+   */
+  bool HasChild(const gd::String& name) const;
+  ///@}
+
+  /**
+   * \brief Decode the element, and all its children, to a
+   * gd::SerializerElement.
+   */
+  SerializerElement ToSerializerElement() const;
+
+ private:
+  /**
+   * \brief The positions of the parts of the element, computed by reading
+   * its header.
+   */
+  struct Layout {
+    bool valid;
+    std::uint8_t flags;
+    std::size_t valueOffset;
+    std::uint32_t arrayOfKey;
+    std::size_t attributesOffset;
+    std::uint32_t attributesCount;
+    std::size_t childrenOffset;
+    std::uint32_t childrenCount;
+  };
+
+  Layout ReadLayout() const;
+  void ReadInto(SerializerElement& element) const;
+  bool FindAttribute(const gd::String& name, SerializerValue& value) const;
+  bool GetAttributeOrChildValue(const gd::String& name,
+                                SerializerValue& value) const;
+
+  /**
+   * \brief Call \a fn(keyIndex, childElement) for each child, until it
+   * returns true.
+   */
+  template <typename Fn>
+  void ForEachChild(const Layout& layout, Fn fn) const;
+
+  const BinarySerializerReader* reader;
+  std::size_t offset;  ///< The position of the element in the data.
+  std::size_t size;    ///< The size of the element in the data.
+};
+
+/**
+ * \brief Read data produced by gd::BinarySerializer, without copying it.
+ *
+ * Only the table of names is decoded when the reader is created. The data
+ * can be memory mapped, and must stay alive as long as the reader is used.
+ *
+ * \see gd::BinarySerializer
+ * \see gd::BinarySerializedElement
+ */
+class GD_CORE_API BinarySerializerReader {
+ public:
+  BinarySerializerReader(const char* data, std::size_t size);
+  virtual ~BinarySerializerReader(){};
+
+  /**
+   * \brief Return false if the data header is not valid.
+   */
+  bool IsValid() const { return valid; }
+
+  /**
+   * \brief Return the root element. It's invalid if the data is not valid.
+   */
+  BinarySerializedElement GetRootElement() const;
+
+  /**
+   * \brief Return the index of the given name in the table of names, or -1
+   * if the name is not used in the data.
+   */
+  std::int64_t GetKeyIndex(const gd::String& name) const;
+
+  /**
+   * \brief Return the name at the given index in the table of names.
+   */
+  const gd::String& GetKey(std::uint32_t index) const;
+
+  const char* GetData() const { return data; }
+  std::size_t GetSize() const { return size; }
+
+ private:
+  const char* data;
+  std::size_t size;
+  bool valid;
+  std::size_t rootOffset;
+  std::vector<gd::String> keys;
+  std::unordered_map<gd::String, std::uint32_t> keysIndices;
+
+  static gd::String badKey;
+};
+
+}  // namespace gd
+
+#endif
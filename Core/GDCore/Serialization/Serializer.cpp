@@ -14,9 +14,11 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Serialization/SerializerElement.h"
-#include "rapidjson/document.h"
-#include "rapidjson/prettywriter.h"
+#include "rapidjson/error/en.h"
+#include "rapidjson/ostreamwrapper.h"
 #include "rapidjson/rapidjson.h"
+#include "rapidjson/reader.h"
+#include "rapidjson/writer.h"
 #if !defined(EMSCRIPTEN)
 #include "GDCore/TinyXml/tinyxml.h"
 #endif
@@ -111,120 +113,287 @@ gd::String Serializer::ToEscapedXMLString(const gd::String& str) {
 }
 
 namespace {
-void RapidJsonValueToElement(const Value& value,
-                             gd::SerializerElement& element) {
-  if (value.IsBool()) {
-    element.SetBoolValue(value.GetBool());
-  } else if (value.IsNumber()) {
-    if (value.IsInt64())
-      element.SetIntValue(value.GetInt64());
-    else if (value.IsUint64())
-      element.SetIntValue(value.GetUint64());
-    else if (value.IsInt())
-      element.SetValue(value.GetInt());
-    else if (value.IsUint())
-      element.SetValue(value.GetUint());
-    else if (value.IsDouble())
-      element.SetValue(value.GetDouble());
-    else if (value.IsFloat())
-      element.SetValue(value.GetFloat());
-  } else if (value.IsString()) {
-    element.SetStringValue(value.GetString());
-  } else if (value.IsObject()) {
-    for (auto& m : value.GetObject()) {
-      RapidJsonValueToElement(m.value, element.AddChild(m.name.GetString()));
-    }
-  } else if (value.IsArray()) {
+/**
+ * \brief A rapidjson SAX handler building a gd::SerializerElement while the
+ * JSON is being read, without any intermediate document.
+ */
+class SerializerElementReaderHandler
+    : public BaseReaderHandler<UTF8<>, SerializerElementReaderHandler> {
+ public:
+  SerializerElementReaderHandler(gd::SerializerElement& rootElement_)
+      : rootElement(rootElement_){};
+
+  bool Null() {
+    NextElement();
+    return true;
+  }
+  bool Bool(bool b) {
+    NextElement().SetBoolValue(b);
+    return true;
+  }
+  bool Int(int i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint(unsigned u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Int64(int64_t i) {
+    NextElement().SetIntValue(i);
+    return true;
+  }
+  bool Uint64(uint64_t u) {
+    NextElement().SetIntValue(u);
+    return true;
+  }
+  bool Double(double d) {
+    NextElement().SetValue(d);
+    return true;
+  }
+  bool String(const char* str, SizeType length, bool copy) {
+    NextElement().SetStringValue(str);
+    return true;
+  }
+  bool StartObject() {
+    parents.push_back(&NextElement());
+    return true;
+  }
+  bool Key(const char* str, SizeType length, bool copy) {
+    key = str;
+    return true;
+  }
+  bool EndObject(SizeType memberCount) {
+    parents.pop_back();
+    return true;
+  }
+  bool StartArray() {
+    gd::SerializerElement& element = NextElement();
     element.ConsiderAsArray();
-    for (auto& m : value.GetArray()) {
-      RapidJsonValueToElement(m, element.AddChild(""));
+    parents.push_back(&element);
+    return true;
+  }
+  bool EndArray(SizeType elementCount) {
+    parents.pop_back();
+    return true;
+  }
+
+ private:
+  /**
+   * \brief Return the element that will receive the value being read.
+   */
+  gd::SerializerElement& NextElement() {
+    // Only one root value is accepted by the reader.
+    if (parents.empty()) return rootElement;
+
+    gd::SerializerElement& parent = *parents.back();
+    return parent.ConsideredAsArray() ? parent.AddChild("")
+                                      : parent.AddChild(std::move(key));
+  }
+
+  gd::SerializerElement& rootElement;
+  std::vector<gd::SerializerElement*> parents;
+  gd::String key;  ///< The name of the last read key of the current object.
+};
+
+/**
+ * \brief A rapidjson input stream reading from a function called to fill
+ * a fixed size buffer, chunk by chunk.
+ */
+class ChunkedReadStream {
+ public:
+  typedef char Ch;
+
+  ChunkedReadStream(std::function<std::size_t(char*, std::size_t)> readChunk_)
+      : readChunk(readChunk_),
+        buffer(bufferSize),
+        current(nullptr),
+        bufferEnd(nullptr),
+        count(0),
+        eof(false) {
+    Read();
+  }
+
+  Ch Peek() const { return *current; }
+  Ch Take() {
+    Ch c = *current;
+    Read();
+    return c;
+  }
+  size_t Tell() const {
+    return count + static_cast<size_t>(current - buffer.data());
+  }
+
+  // Not implemented, only required by the stream concept.
+  void Put(Ch) { RAPIDJSON_ASSERT(false); }
+  void Flush() { RAPIDJSON_ASSERT(false); }
+  Ch* PutBegin() {
+    RAPIDJSON_ASSERT(false);
+    return 0;
+  }
+  size_t PutEnd(Ch*) {
+    RAPIDJSON_ASSERT(false);
+    return 0;
+  }
+
+ private:
+  void Read() {
+    if (current < bufferEnd) {
+      ++current;
+      if (current < bufferEnd) return;
+    }
+    if (eof) {
+      // Stay on the terminating null character.
+      current = bufferEnd;
+      return;
     }
+
+    if (bufferEnd) count += static_cast<size_t>(bufferEnd - buffer.data());
+    std::size_t readSize = readChunk(buffer.data(), bufferSize - 1);
+    if (readSize > bufferSize - 1) readSize = bufferSize - 1;
+    bufferEnd = buffer.data() + readSize;
+    current = buffer.data();
+    *bufferEnd = '\0';
+    if (readSize == 0) eof = true;
   }
+
+  static constexpr std::size_t bufferSize = 64 * 1024;
+
+  std::function<std::size_t(char*, std::size_t)> readChunk;
+  std::vector<char> buffer;
+  char* current;
+  char* bufferEnd;  ///< Always pointing to a null character.
+  size_t count;     ///< Bytes read before the current buffer.
+  bool eof;
+};
+
+template <typename InputStream>
+SerializerElement ParseJSON(InputStream& stream, JSONParseError& error) {
+  SerializerElement element;
+  element.UseArenaAllocation();
+  SerializerElementReaderHandler handler(element);
+  Reader reader;
+  ParseResult result = reader.Parse(stream, handler);
+  if (result.IsError()) {
+    error.code = result.Code();
+    error.offset = result.Offset();
+    error.message = GetParseError_En(result.Code());
+    element = SerializerElement();
+  }
+
+  return element;  // Only one returned variable so that no copy is made.
 }
 
-void ElementToRapidJson(const gd::SerializerElement& element,
-                        Value& value,
-                        Document::AllocatorType& allocator) {
-  if (!element.IsValueUndefined()) {
-    const SerializerValue& serializerValue = element.GetValue();
-    // TODO: use GetRaw to avoid conversions
-    if (serializerValue.IsBoolean())
-      value.SetBool(serializerValue.GetBool());
-    else if (serializerValue.IsDouble())
-      value.SetDouble(serializerValue.GetDouble());
-    else if (serializerValue.IsInt())
-      value.SetInt(serializerValue.GetInt());
-    else if (serializerValue.IsString()) {
-      // This does a copy of the string, and measure the string length.
-      value.SetString(serializerValue.GetRawString().c_str(), allocator);
-    }
-  } else if (element.ConsideredAsArray()) {
-    value.SetArray();
+void LogJSONParseError(const JSONParseError& error) {
+  std::cout << "Error while parsing JSON at offset " << error.offset << ": "
+            << error.message << std::endl;
+}
 
-    const auto& children = element.GetAllChildren();
-    value.Reserve(children.size(), allocator);
+/**
+ * \brief A rapidjson output stream appending to a std::string.
+ */
+class StringAppendStream {
+ public:
+  typedef char Ch;
+
+  StringAppendStream(std::string& output_) : output(output_){};
+
+  void Put(Ch c) { output.push_back(c); }
+  void Flush() {}
+
+ private:
+  std::string& output;
+};
+
+template <typename Writer>
+void WriteValue(const gd::SerializerValue& value, Writer& writer) {
+  // TODO: use GetRaw to avoid conversions
+  if (value.IsBoolean())
+    writer.Bool(value.GetBool());
+  else if (value.IsDouble())
+    writer.Double(value.GetDouble());
+  else if (value.IsInt())
+    writer.Int(value.GetInt());
+  else if (value.IsString())
+    writer.String(value.GetRawString().c_str());
+  else
+    writer.Null();
+}
 
-    for (const auto& child : children) {
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.PushBack(childValue, allocator);
+/**
+ * \brief Write the element to the writer, token by token, without
+ * any intermediate document.
+ */
+template <typename Writer>
+void WriteElement(const gd::SerializerElement& element, Writer& writer) {
+  if (!element.IsValueUndefined()) {
+    WriteValue(element.GetValue(), writer);
+  } else if (element.ConsideredAsArray()) {
+    writer.StartArray();
+    for (const auto& child : element.GetAllChildren()) {
+      WriteElement(*child.second, writer);
     }
+    writer.EndArray();
   } else {
-    value.SetObject();
-
-    const auto& attributes = element.GetAllAttributes();
-    const auto& children = element.GetAllChildren();
-
-    for (const auto& attribute : attributes) {
-      Value name(attribute.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(attribute.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+    writer.StartObject();
+    for (const auto& attribute : element.GetAllAttributes()) {
+      writer.Key(attribute.first.c_str());
+      WriteValue(attribute.second, writer);
     }
-    for (const auto& child : children) {
-      Value name(child.first.c_str(),
-                 allocator);  // Copying the name is required.
-      Value childValue;
-      ElementToRapidJson(*child.second, childValue, allocator);
-      value.AddMember(name, childValue, allocator);
+    for (const auto& child : element.GetAllChildren()) {
+      writer.Key(child.first.c_str());
+      WriteElement(*child.second, writer);
     }
+    writer.EndObject();
   }
 }
 }  // namespace
 
 SerializerElement Serializer::FromJSON(const char* json) {
-  SerializerElement element;
-  size_t len = strlen(json);
-  if (len != 0) {
-    Document document;
-
-    // In-situ parsing, decode strings directly in the source string. Source
-    // must be string.
-    char buffer[len + 1];
-    memcpy(buffer, json, len + 1);
-    if (document.ParseInsitu(buffer).HasParseError()) {
-      std::cout << "TODO: error while parsing" << std::endl;
-      return element;
-    }
-
-    RapidJsonValueToElement(document, element);
-  }
+  JSONParseError error;
+  SerializerElement element = FromJSON(json, error);
+  if (error.HasError()) LogJSONParseError(error);
 
   return element;
 }
 
+SerializerElement Serializer::FromJSON(const char* json,
+                                       JSONParseError& error) {
+  error = JSONParseError();
+  if (json[0] == '\0') return SerializerElement();
+
+  StringStream stream(json);
+  return ParseJSON(stream, error);
+}
+
+SerializerElement Serializer::FromJSONChunks(
+    std::function<std::size_t(char*, std::size_t)> readChunk,
+    JSONParseError& error) {
+  error = JSONParseError();
+  ChunkedReadStream stream(readChunk);
+  if (stream.Peek() == '\0') return SerializerElement();
+
+  return ParseJSON(stream, error);
+}
+
 gd::String Serializer::ToJSON(const SerializerElement& element) {
-  Document document;
-  Document::AllocatorType& allocator = document.GetAllocator();
+  gd::String output;
+  ToJSON(element, output);
 
-  ElementToRapidJson(element, document, allocator);
+  return output;
+}
 
-  StringBuffer buffer;
-  Writer<StringBuffer> writer(buffer);
-  document.Accept(writer);
+void Serializer::ToJSON(const SerializerElement& element, gd::String& output) {
+  StringAppendStream stream(output.Raw());
+  Writer<StringAppendStream> writer(stream);
+  WriteElement(element, writer);
+}
 
-  return buffer.GetString();  // Temporary copy
+void Serializer::ToJSON(const SerializerElement& element,
+                        std::ostream& output) {
+  OStreamWrapper stream(output);
+  Writer<OStreamWrapper> writer(stream);
+  WriteElement(element, writer);
 }
 
 }  // namespace gd
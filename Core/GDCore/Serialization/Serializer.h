@@ -6,12 +6,32 @@
 
 #ifndef GDCORE_SERIALIZER_H
 #define GDCORE_SERIALIZER_H
+#include <functional>
+#include <ostream>
 #include <string>
 #include "GDCore/Serialization/SerializerElement.h"
 class TiXmlElement;
 
 namespace gd {
 
+/**
+ * \brief Describe an error that happened while parsing JSON.
+ *
+ * \see gd::Serializer::FromJSON
+ */
+struct GD_CORE_API JSONParseError {
+  JSONParseError() : code(0), offset(0){};
+
+  /**
+   * \brief Return true if an error happened.
+   */
+  bool HasError() const { return code != 0; }
+
+  int code;  ///< The error code (see rapidjson::ParseErrorCode), 0 if no error.
+  std::size_t offset;  ///< The offset, in bytes, where the error happened.
+  gd::String message;  ///< A human readable description of the error.
+};
+
 /**
  * \brief The class used to save/load projects and GDCore classes
  * from/to XML or JSON.
@@ -44,8 +64,28 @@ class GD_CORE_API Serializer {
    */
   static gd::String ToJSON(const SerializerElement& element);
 
+  /**
+   * \brief Serialize a gd::SerializerElement to JSON, appended at the end of
+   * \a output.
+   *
+   * The JSON is written directly while the element is visited (no intermediate
+   * JSON document is created), so the memory used is only the one of the
+   * output.
+   */
+  static void ToJSON(const SerializerElement& element, gd::String& output);
+
+  /**
+   * \brief Serialize a gd::SerializerElement to JSON, written directly into
+   * the given output stream (for example, a file).
+   */
+  static void ToJSON(const SerializerElement& element, std::ostream& output);
+
   /**
    * \brief Construct a gd::SerializerElement from a JSON string.
+   *
+   * The element is built directly while the string is read (no intermediate
+   * JSON document is created). In case of a parse error, the error is logged
+   * and an empty element is returned.
    */
   static SerializerElement FromJSON(const char* json);
 
@@ -55,6 +95,28 @@ class GD_CORE_API Serializer {
   static SerializerElement FromJSON(const gd::String& json) {
     return FromJSON(json.c_str());
   }
+
+  /**
+   * \brief Construct a gd::SerializerElement from a JSON string,
+   * and report any parse error in \a error.
+   *
+   * In case of a parse error, an empty element is returned.
+   */
+  static SerializerElement FromJSON(const char* json, JSONParseError& error);
+
+  /**
+   * \brief Construct a gd::SerializerElement from JSON read chunk by chunk,
+   * so that the whole input never has to be held in memory.
+   *
+   * \param readChunk A function filling the buffer passed as first argument
+   * with at most the number of bytes passed as second argument, and returning
+   * the number of bytes written (0 when the end of the input is reached).
+   * \param error Filled with the parse error, if any. In this case, an empty
+   * element is returned.
+   */
+  static SerializerElement FromJSONChunks(
+      std::function<std::size_t(char*, std::size_t)> readChunk,
+      JSONParseError& error);
   ///@}
 
   virtual ~Serializer(){};
@@ -0,0 +1,42 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Serialization/SerializerArena.h"
+
+#include <cstdint>
+
+namespace {
+constexpr std::size_t blockSize = 64 * 1024;
+}  // namespace
+
+namespace gd {
+
+SerializerArena::SerializerArena() : current(nullptr), end(nullptr) {}
+
+SerializerArena::~SerializerArena() {}
+
+void* SerializerArena::Allocate(std::size_t size, std::size_t alignment) {
+  std::uintptr_t address = reinterpret_cast<std::uintptr_t>(current);
+  std::size_t padding = (alignment - address % alignment) % alignment;
+  if (!current || (std::size_t)(end - current) < padding + size) {
+    // Big allocations get their own block, to avoid wasting the current one.
+    std::size_t newBlockSize =
+        size + alignment > blockSize / 4 ? size + alignment : blockSize;
+    blocks.emplace_back(new char[newBlockSize]);
+    char* block = blocks.back().get();
+    address = reinterpret_cast<std::uintptr_t>(block);
+    padding = (alignment - address % alignment) % alignment;
+    if (newBlockSize != blockSize) return block + padding;
+
+    current = block;
+    end = block + blockSize;
+  }
+
+  void* allocated = current + padding;
+  current += padding + size;
+  return allocated;
+}
+
+}  // namespace gd
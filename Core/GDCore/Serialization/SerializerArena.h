@@ -0,0 +1,94 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_SERIALIZERARENA_H
+#define GDCORE_SERIALIZERARENA_H
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace gd {
+
+/**
+ * \brief A monotonic memory arena, used to allocate the elements of a
+ * gd::SerializerElement tree.
+ *
+ * Memory is taken from large blocks and is never given back individually:
+ * all the blocks are freed at once when the arena is destroyed.
+ *
+ * \note Not thread-safe: a tree of elements must be built from a single thread.
+ *
+ * \see gd::SerializerElement::UseArenaAllocation
+ */
+class GD_CORE_API SerializerArena {
+ public:
+  SerializerArena();
+  virtual ~SerializerArena();
+
+  /**
+   * \brief Allocate \a size bytes, aligned on \a alignment.
+   */
+  void* Allocate(std::size_t size, std::size_t alignment);
+
+  /**
+   * \brief Return the number of blocks allocated from the system.
+   */
+  std::size_t GetBlocksCount() const { return blocks.size(); }
+
+ private:
+  SerializerArena(const SerializerArena&) = delete;
+  SerializerArena& operator=(const SerializerArena&) = delete;
+
+  std::vector<std::unique_ptr<char[]>> blocks;
+  char* current;  ///< The next free byte in the current block.
+  char* end;      ///< The end of the current block.
+};
+
+/**
+ * \brief A standard allocator taking its memory from a gd::SerializerArena.
+ *
+ * The allocator keeps the arena alive: memory is released when the arena
+ * is no more used by any allocator.
+ */
+template <typename T>
+class SerializerArenaAllocator {
+ public:
+  typedef T value_type;
+
+  SerializerArenaAllocator(std::shared_ptr<SerializerArena> arena_)
+      : arena(std::move(arena_)){};
+  template <typename U>
+  SerializerArenaAllocator(const SerializerArenaAllocator<U>& other)
+      : arena(other.GetArena()){};
+
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T*, std::size_t) {
+    // Memory is freed when the arena is destroyed.
+  }
+
+  const std::shared_ptr<SerializerArena>& GetArena() const { return arena; }
+
+ private:
+  std::shared_ptr<SerializerArena> arena;
+};
+
+template <typename T, typename U>
+bool operator==(const SerializerArenaAllocator<T>& a,
+                const SerializerArenaAllocator<U>& b) {
+  return a.GetArena() == b.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const SerializerArenaAllocator<T>& a,
+                const SerializerArenaAllocator<U>& b) {
+  return !(a == b);
+}
+
+}  // namespace gd
+
+#endif
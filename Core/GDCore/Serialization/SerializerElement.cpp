@@ -2,14 +2,28 @@
 
 #include <iostream>
 
+#include "GDCore/Serialization/SerializerArena.h"
+
+namespace {
+/**
+ * Under this number of children, no index of the children names is built
+ * (a linear search is fast enough).
+ */
+constexpr std::size_t childrenIndexMinimumSize = 16;
+}  // namespace
+
 namespace gd {
 
 SerializerElement SerializerElement::nullElement;
 
-SerializerElement::SerializerElement() : valueUndefined(true), isArray(false) {}
+SerializerElement::SerializerElement()
+    : valueUndefined(true), isArray(false), childrenIndexBuilt(false) {}
 
 SerializerElement::SerializerElement(const SerializerValue& value)
-    : valueUndefined(false), elementValue(value), isArray(false) {}
+    : valueUndefined(false),
+      elementValue(value),
+      isArray(false),
+      childrenIndexBuilt(false) {}
 
 SerializerElement::~SerializerElement() {}
 
@@ -152,19 +166,115 @@ SerializerElement& SerializerElement::AddChild(gd::String name) {
 
   // In case of children of objects, there can be only one child with
   // a given name.
-  // Note: searching for the existing children is O(number of children). This
-  // could be improved, but in practice has no visible impact on saving
-  // large projects.
-  if (!isArray && HasChild(name)) {
-    return GetChild(name);
+  if (!isArray) {
+    SerializerElement* existingChild = FindChild(name, false, "", 0);
+    if (existingChild) return *existingChild;
   }
 
-  std::shared_ptr<SerializerElement> newElement(new SerializerElement);
-  children.push_back(std::make_pair(name, newElement));
+  std::shared_ptr<SerializerElement> newElement = CreateChild();
+  if (childrenIndexBuilt) childrenIndex[name].push_back(children.size());
+  children.push_back(std::make_pair(std::move(name), newElement));
 
   return *newElement;
 }
 
+bool SerializerElement::UpdateChildrenIndex() const {
+  if (childrenIndexBuilt) return true;
+  if (children.size() < childrenIndexMinimumSize) return false;
+
+  childrenIndex.clear();
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+    childrenIndex[children[i].first].push_back(i);
+  }
+  childrenIndexBuilt = true;
+  return true;
+}
+
+const std::vector<std::size_t>* SerializerElement::GetIndexedChildrenPositions(
+    const gd::String& name) const {
+  auto it = childrenIndex.find(name);
+  return it != childrenIndex.end() ? &it->second : nullptr;
+}
+
+template <typename Fn>
+void SerializerElement::ForEachChildNamed(const gd::String& name,
+                                          bool includeUnnamed,
+                                          const gd::String& deprecatedName,
+                                          Fn fn) const {
+  if (!UpdateChildrenIndex()) {
+    for (size_t i = 0; i < children.size(); ++i) {
+      if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
+
+      if (children[i].first == name ||
+          (includeUnnamed && children[i].first.empty()) ||
+          (!deprecatedName.empty() && children[i].first == deprecatedName)) {
+        if (fn(i)) return;
+      }
+    }
+    return;
+  }
+
+  // Merge, in order, the positions of the children having any of the names.
+  const std::vector<std::size_t>* positionsLists[3] = {
+      GetIndexedChildrenPositions(name),
+      includeUnnamed && !name.empty() ? GetIndexedChildrenPositions("")
+                                      : nullptr,
+      !deprecatedName.empty() && deprecatedName != name
+          ? GetIndexedChildrenPositions(deprecatedName)
+          : nullptr};
+  std::size_t nextIndices[3] = {0, 0, 0};
+  while (true) {
+    int nextList = -1;
+    for (int list = 0; list < 3; ++list) {
+      if (!positionsLists[list] ||
+          nextIndices[list] >= positionsLists[list]->size())
+        continue;
+
+      if (nextList == -1 ||
+          (*positionsLists[list])[nextIndices[list]] <
+              (*positionsLists[nextList])[nextIndices[nextList]])
+        nextList = list;
+    }
+    if (nextList == -1) return;
+
+    if (fn((*positionsLists[nextList])[nextIndices[nextList]++])) return;
+  }
+}
+
+SerializerElement* SerializerElement::FindChild(
+    const gd::String& name,
+    bool includeUnnamed,
+    const gd::String& deprecatedName,
+    std::size_t index) const {
+  if (UpdateChildrenIndex()) {
+    // Fast path when the children can only have the requested name.
+    const std::vector<std::size_t>* positions =
+        GetIndexedChildrenPositions(name);
+    if ((!includeUnnamed || name.empty() ||
+         !GetIndexedChildrenPositions("")) &&
+        (deprecatedName.empty() || deprecatedName == name ||
+         !GetIndexedChildrenPositions(deprecatedName))) {
+      return positions && index < positions->size()
+                 ? children[(*positions)[index]].second.get()
+                 : nullptr;
+    }
+  }
+
+  SerializerElement* child = nullptr;
+  std::size_t currentIndex = 0;
+  ForEachChildNamed(
+      name, includeUnnamed, deprecatedName, [&](std::size_t position) {
+        if (currentIndex++ != index) return false;
+
+        child = children[position].second.get();
+        return true;
+      });
+
+  return child;
+}
+
 SerializerElement& SerializerElement::GetChild(std::size_t index) const {
   if (!isArray) {
     std::cout << "ERROR: Getting a child from its index whereas the parent is "
@@ -173,19 +283,8 @@ SerializerElement& SerializerElement::GetChild(std::size_t index) const {
     return nullElement;
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == arrayOf || children[i].first.empty() ||
-        (!deprecatedArrayOf.empty() &&
-         children[i].first == deprecatedArrayOf)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
-    }
-  }
+  SerializerElement* child = FindChild(arrayOf, true, deprecatedArrayOf, index);
+  if (child) return *child;
 
   std::cout << "ERROR: Requested out of bound child at index " << index
             << std::endl;
@@ -204,18 +303,8 @@ SerializerElement& SerializerElement::GetChild(
     }
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName)) {
-      if (index == currentIndex)
-        return *children[i].second;
-      else
-        currentIndex++;
-    }
-  }
+  SerializerElement* child = FindChild(name, isArray, deprecatedName, index);
+  if (child) return *child;
 
   std::cout << "Child " << name << " not found in SerializerElement::GetChild"
             << std::endl;
@@ -237,38 +326,43 @@ std::size_t SerializerElement::GetChildrenCount(
     deprecatedName = deprecatedArrayOf;
   }
 
-  std::size_t currentIndex = 0;
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name || (isArray && children[i].first.empty()) ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      currentIndex++;
+  std::size_t count = 0;
+  if (UpdateChildrenIndex()) {
+    const std::vector<std::size_t>* positionsLists[3] = {
+        GetIndexedChildrenPositions(name),
+        isArray && !name.empty() ? GetIndexedChildrenPositions("") : nullptr,
+        !deprecatedName.empty() && deprecatedName != name
+            ? GetIndexedChildrenPositions(deprecatedName)
+            : nullptr};
+    for (const auto* positions : positionsLists) {
+      if (positions) count += positions->size();
+    }
+    return count;
   }
 
-  return currentIndex;
+  ForEachChildNamed(name, isArray, deprecatedName, [&](std::size_t position) {
+    count++;
+    return false;
+  });
+  return count;
 }
 
 bool SerializerElement::HasChild(const gd::String& name,
                                  gd::String deprecatedName) const {
-  for (size_t i = 0; i < children.size(); ++i) {
-    if (children[i].second == std::shared_ptr<SerializerElement>()) continue;
-
-    if (children[i].first == name ||
-        (!deprecatedName.empty() && children[i].first == deprecatedName))
-      return true;
-  }
-
-  return false;
+  return FindChild(name, false, deprecatedName, 0) != nullptr;
 }
 
 void SerializerElement::RemoveChild(const gd::String& name) {
+  // Avoid invalidating the index if there is nothing to remove.
+  if (childrenIndexBuilt && !GetIndexedChildrenPositions(name)) return;
+
   for (size_t i = 0; i < children.size();) {
     if (children[i].first == name)
       children.erase(children.begin() + i);
     else
       ++i;
   }
+  InvalidateChildrenIndex();
 }
 
 void SerializerElement::Init(const gd::SerializerElement& other) {
@@ -276,17 +370,33 @@ void SerializerElement::Init(const gd::SerializerElement& other) {
   elementValue = other.elementValue;
   attributes = other.attributes;
 
+  // Children are copied in elements allocated from the arena of this
+  // element (if any), not the one of the other element.
   children.clear();
   for (const auto& child : other.children) {
-    children.push_back(
-        std::make_pair(child.first,
-                       std::shared_ptr<SerializerElement>(
-                           new SerializerElement(*child.second))));
+    std::shared_ptr<SerializerElement> newElement = CreateChild();
+    newElement->Init(*child.second);
+    children.push_back(std::make_pair(child.first, std::move(newElement)));
   }
 
   isArray = other.isArray;
   arrayOf = other.arrayOf;
   deprecatedArrayOf = other.deprecatedArrayOf;
+
+  InvalidateChildrenIndex();
+}
+
+std::shared_ptr<SerializerElement> SerializerElement::CreateChild() const {
+  std::shared_ptr<SerializerElement> child =
+      arena ? std::allocate_shared<SerializerElement>(
+                  SerializerArenaAllocator<SerializerElement>(arena))
+            : std::make_shared<SerializerElement>();
+  child->arena = arena;
+  return child;
+}
+
+void SerializerElement::UseArenaAllocation() {
+  if (!arena) arena = std::make_shared<SerializerArena>();
 }
 
 void SerializerElement::SetMultilineStringValue(const gd::String& value) {
@@ -297,6 +407,7 @@ void SerializerElement::SetMultilineStringValue(const gd::String& value) {
 
   std::vector<gd::String> lines = value.Split('\n');
   children.clear();
+  InvalidateChildrenIndex();
   ConsiderAsArrayOf("");
   for (const auto& line : lines) {
     AddChild("").SetStringValue(line);
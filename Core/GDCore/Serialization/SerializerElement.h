@@ -9,11 +9,16 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "GDCore/Serialization/SerializerValue.h"
 #include "GDCore/String.h"
 
+namespace gd {
+class SerializerArena;
+}
+
 namespace gd {
 
 /**
@@ -28,9 +33,11 @@ namespace gd {
  * It also has specialized methods in GDevelop.js (see postjs.js) to be
  * converted to a JavaScript object.
  *
- * \note Children are stored with their order preserved, but this also
- * means that their access/removal is O(number of children). This class
- * is not appropriated for a use in game where fast access is required.
+ * \note Children are stored with their order preserved. When an element has
+ * a lot of children, an index of their names is built on the first access
+ * so that finding a child is O(1) (removing a child is still
+ * O(number of children)). This class is not appropriated for a use in game
+ * where fast access is required.
  *
  * \see gd::Serializer
  */
@@ -425,7 +432,6 @@ class GD_CORE_API SerializerElement {
 
   /**
    * \brief Return true if the specified child exists.
-   * \note Complexity is O(number of children).
    * \param name The name of the child to find.
    */
   bool HasChild(const gd::String &name, gd::String deprecatedName = "") const;
@@ -446,6 +452,31 @@ class GD_CORE_API SerializerElement {
   };
   ///@}
 
+  /** \name Memory
+   */
+  ///@{
+  /**
+   * \brief Allocate the children added to this element, and all their own
+   * children, from a single gd::SerializerArena.
+   *
+   * Use this before building a large tree (for example, when loading or
+   * serializing a project): this avoids one allocation per element, and the
+   * whole tree is freed in one shot. The arena is kept alive as long as an
+   * element allocated from it is alive.
+   *
+   * \note The memory of removed children is only released when the whole tree
+   * is destroyed. Names, attributes and values are still allocated separately.
+   */
+  void UseArenaAllocation();
+
+  /**
+   * \brief Return true if the children of the element are allocated from an
+   * arena.
+   * \see UseArenaAllocation
+   */
+  bool IsUsingArenaAllocation() const { return arena != nullptr; }
+  ///@}
+
   static SerializerElement nullElement;
 
  private:
@@ -455,6 +486,57 @@ class GD_CORE_API SerializerElement {
    */
   void Init(const gd::SerializerElement &other);
 
+  /**
+   * \brief Create a new element to be added as a child, allocated from the
+   * arena if any.
+   */
+  std::shared_ptr<SerializerElement> CreateChild() const;
+
+  /**
+   * \brief Call \a fn with the position of each child having the given name
+   * (or no name if \a includeUnnamed is true, or the deprecated name), in
+   * their order, until it returns true.
+   */
+  template <typename Fn>
+  void ForEachChildNamed(const gd::String &name,
+                         bool includeUnnamed,
+                         const gd::String &deprecatedName,
+                         Fn fn) const;
+
+  /**
+   * \brief Return the index-th child having the given name (or no name if
+   * \a includeUnnamed is true, or the deprecated name), or nullptr if not
+   * found.
+   */
+  SerializerElement *FindChild(const gd::String &name,
+                               bool includeUnnamed,
+                               const gd::String &deprecatedName,
+                               std::size_t index) const;
+
+  /**
+   * \brief Return the positions of the children having the given name, or
+   * nullptr if there is none.
+   *
+   * \warning Only valid when the index of children names is built.
+   */
+  const std::vector<std::size_t> *GetIndexedChildrenPositions(
+      const gd::String &name) const;
+
+  /**
+   * \brief Build the index of children names, if worth it and not already
+   * built. Return true if the index can be used.
+   */
+  bool UpdateChildrenIndex() const;
+
+  /**
+   * \brief Invalidate the index of children names, after children were
+   * removed or reordered.
+   */
+  void InvalidateChildrenIndex() {
+    childrenIndexBuilt = false;
+    childrenIndex.clear();
+  }
+
   bool valueUndefined;  ///< If true, the element does not have a value.
   SerializerValue elementValue;
 
@@ -465,6 +547,13 @@ class GD_CORE_API SerializerElement {
   mutable gd::String arrayOf;  ///< The name of the children (was useful for XML
                                ///< parsed elements).
   mutable gd::String deprecatedArrayOf;  ///< Alternate name for children
+
+  mutable bool childrenIndexBuilt;  ///< true if childrenIndex can be used.
+  mutable std::unordered_map<gd::String, std::vector<std::size_t>>
+      childrenIndex;  ///< The positions of the children, for each name.
+
+  std::shared_ptr<SerializerArena>
+      arena;  ///< The arena used to allocate children, if any.
 };
 
 }  // namespace gd
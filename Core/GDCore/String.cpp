@@ -17,30 +17,45 @@ namespace gd
 
 constexpr String::size_type String::npos;
 
-String::String() : m_string()
+String::String() : m_string(), m_size(0)
 {
 
 }
 
-String::String(const char *characters) : m_string()
+String::String(const char *characters) : m_string(), m_size(0)
 {
     *this = characters;
 }
 
-String::String(const std::u32string &string) : m_string()
+String::String(const std::u32string &string) : m_string(), m_size(0)
 {
     *this = string;
 }
 
+String::String(const String &other) :
+    m_string(other.m_string),
+    m_size(other.m_size.load(std::memory_order_relaxed))
+{
+
+}
+
+String::String(String &&other) noexcept :
+    m_string(std::move(other.m_string)),
+    m_size(other.m_size.load(std::memory_order_relaxed))
+{
+    other.clear();
+}
+
 String& String::operator=(const char *characters)
 {
     m_string = std::string(characters);
+    m_size.store(npos, std::memory_order_relaxed);
     return *this;
 }
 
 String& String::operator=(const std::u32string &string)
 {
-    m_string.clear();
+    clear();
 
     //In theory, an UTF8 character can be up to 6 bytes (even if in the current Unicode standard,
     //the last character is 4 bytes long when encoded in UTF8).
@@ -58,9 +73,51 @@ String& String::operator=(const std::u32string &string)
     return *this;
 }
 
-String::size_type String::size() const
+String& String::operator=(const String &other)
+{
+    m_string = other.m_string;
+    m_size.store(other.m_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+String& String::operator=(String &&other) noexcept
 {
-    return std::distance(begin(), end());
+    if(this == &other)
+        return *this;
+
+    m_string = std::move(other.m_string);
+    m_size.store(other.m_size.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    other.clear();
+    return *this;
+}
+
+String::size_type String::ComputeSize() const
+{
+    //ASCII characters are one byte long: only decode the string after the
+    //first non ASCII character.
+    std::string::const_iterator firstNonASCII = std::find_if(m_string.begin(), m_string.end(),
+        [](char byte) { return (static_cast<unsigned char>(byte) & 0x80) != 0; });
+
+    return std::distance(m_string.begin(), firstNonASCII) +
+        std::distance(const_iterator(firstNonASCII), end());
+}
+
+std::string::size_type String::GetBytePosition( size_type position ) const
+{
+    if(IsASCII())
+        return position;
+
+    const_iterator it = begin();
+    std::advance(it, position);
+    return std::distance(m_string.begin(), it.base());
+}
+
+String::size_type String::GetPositionFromBytePosition( std::string::size_type bytePosition ) const
+{
+    if(IsASCII())
+        return bytePosition;
+
+    return std::distance(begin(), const_iterator(m_string.begin() + bytePosition));
 }
 
 String::iterator String::begin()
@@ -189,12 +246,16 @@ String& String::ReplaceInvalid( value_type replacement )
     ::utf8::replace_invalid(m_string.begin(), m_string.end(), std::back_inserter(validStr), replacement);
 
     m_string = validStr;
+    m_size.store(npos, std::memory_order_relaxed);
 
     return *this;
 }
 
 String::value_type String::operator[]( const String::size_type position ) const
 {
+    if(IsASCII())
+        return static_cast<unsigned char>(m_string[position]);
+
     const_iterator it = begin();
     std::advance(it, position);
     return *it;
@@ -202,13 +263,18 @@ String::value_type String::operator[]( const String::size_type position ) const
 
 String& String::operator+=( const String &other )
 {
+    size_type size = m_size.load(std::memory_order_relaxed);
+    size_type otherSize = other.m_size.load(std::memory_order_relaxed);
+
     m_string += other.m_string;
+    m_size.store(size != npos && otherSize != npos ? size + otherSize : npos, std::memory_order_relaxed);
     return *this;
 }
 
 String& String::operator+=( const char *other )
 {
     m_string += other;
+    m_size.store(npos, std::memory_order_relaxed);
     return *this;
 }
 
@@ -221,20 +287,26 @@ String& String::operator+=( value_type character )
 void String::push_back( String::value_type character )
 {
     ::utf8::unchecked::append(character, std::back_inserter(m_string));
+
+    size_type size = m_size.load(std::memory_order_relaxed);
+    if(size != npos)
+        m_size.store(size + 1, std::memory_order_relaxed);
 }
 
 void String::pop_back()
 {
     m_string.erase((--end()).base(), end().base());
+
+    size_type size = m_size.load(std::memory_order_relaxed);
+    if(size != npos && size != 0)
+        m_size.store(size - 1, std::memory_order_relaxed);
 }
 
 String& String::insert( size_type pos, const String &str )
 {
-    iterator it = begin();
-    std::advance(it, pos);
-
-    //Use the real position as bytes using the std::string::iterators
-    m_string.insert( std::distance(m_string.begin(), it.base()), str.m_string );
+    //Use the real position as bytes in the std::string
+    m_string.insert( GetBytePosition(pos), str.m_string );
+    m_size.store(npos, std::memory_order_relaxed);
 
     return *this;
 }
@@ -278,6 +350,7 @@ String &String::RemoveConsecutiveOccurrences(iterator i1,
 String& String::replace( iterator i1, iterator i2, const String &str )
 {
     m_string.replace(i1.base(), i2.base(), str.m_string);
+    m_size.store(npos, std::memory_order_relaxed);
 
     return *this;
 }
@@ -285,6 +358,7 @@ String& String::replace( iterator i1, iterator i2, const String &str )
 String& String::replace( iterator i1, iterator i2, size_type n, const char c )
 {
     m_string.replace(i1.base(), i2.base(), n, c);
+    m_size.store(npos, std::memory_order_relaxed);
 
     return *this;
 }
@@ -327,11 +401,13 @@ String& String::replace( String::size_type pos, String::size_type len, const Str
 
 String::iterator String::erase( String::iterator first, String::iterator last )
 {
+    m_size.store(npos, std::memory_order_relaxed);
     return iterator( m_string.erase( first.base(), last.base() ) );
 }
 
 String::iterator String::erase( String::iterator p )
 {
+    m_size.store(npos, std::memory_order_relaxed);
     return iterator( m_string.erase( p.base() ) );
 }
 
@@ -441,6 +517,7 @@ String& String::Normalize(String::NormForm form)
         newStr = utf8proc_NFKC((unsigned char*)m_string.c_str());
 
     m_string = (char*)newStr;
+    m_size.store(npos, std::memory_order_relaxed);
 
     free(newStr);
 
@@ -451,6 +528,16 @@ String String::substr( String::size_type start, String::size_type length ) const
 {
     String str;
 
+    if(IsASCII())
+    {
+        if(start > m_string.size()) //We reach the end of the string before the start position
+            throw std::out_of_range("[gd::String::substr] starting pos greater than size");
+
+        str.m_string = m_string.substr( start, length );
+        str.m_size.store(str.m_string.size(), std::memory_order_relaxed);
+        return str;
+    }
+
     const_iterator startIt = begin();
     while(start > 0 && startIt != end())
     {
@@ -468,33 +555,26 @@ String String::substr( String::size_type start, String::size_type length ) const
     }
 
     str.m_string = std::string( startIt.base(), endIt.base() );
+    str.m_size.store(npos, std::memory_order_relaxed);
 
     return str;
 }
 
 String::size_type String::find( const String &search, String::size_type pos ) const
 {
-    const_iterator it = begin();
-
     //Move to pos
-    if(pos < size())
-        std::advance( it, pos );
-    else
+    if(pos >= size())
         return npos;
 
     //Use the standard std::string to find a string (using their internal std::strings).
-    //Use the raw std::string iterator to get the offset as a **byte** count for the starting
-    //position.
+    //Use the offset as a **byte** count for the starting position.
     std::string::size_type findPos =
-        m_string.find( search.m_string, std::distance( m_string.begin(), it.base() ) );
+        m_string.find( search.m_string, GetBytePosition(pos) );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator from the std::string::iterator pointing to the find result.
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance in **characters** count (that's why we need a String::iterator).
-        return std::distance( begin(), findPosIt );
+        //Return the position in **characters** count.
+        return GetPositionFromBytePosition(findPos);
     }
     else
         return npos;
@@ -512,32 +592,18 @@ String::size_type String::find( const String::value_type search, String::size_ty
 
 String::size_type String::rfind( const String &search, String::size_type pos ) const
 {
-    //Move to pos + 1 (we will then get the last byte of the character at pos)
-    const_iterator it = begin();
-    std::string::const_iterator baseIt;
-    if( pos < size() ) //little optimization by testing npos directly (avoid calculating size())
-    {
-        std::advance( it, pos + 1 );
-        baseIt = it.base();
-        --baseIt; //Decrement the std::string::iterator by one because we need
-        //it to point to the last byte of the character at pos
-    }
-
     //The last character is included, so we need to put the position
-    //of the last byte of the character at the position "pos"
+    //of the last byte of the character at the position "pos" (i.e. the byte before the
+    //character at pos + 1)
     std::string::size_type findPos = m_string.rfind( search.m_string,
-        pos < size() ? std::distance( m_string.begin(), baseIt ) : std::string::npos
+        pos < size() ? GetBytePosition(pos + 1) - 1 : std::string::npos
         );
 
     if( findPos != std::string::npos )
     {
-        //Create a String::iterator to the find position to be able to get the real
-        //distance as characters count (it would be a distance as bytes count
-        //with a std::string::iterator)
-        const_iterator findPosIt( m_string.begin() + findPos );
-
-        //Return the distance (which is a distance as characters count)
-        return std::distance( begin(), findPosIt );
+        //Return the position as characters count (it would be a position as bytes count
+        //in the std::string)
+        return GetPositionFromBytePosition(findPos);
     }
     else
         return npos;
@@ -672,23 +738,50 @@ String::size_type String::FindCaseInsensitive( const String &search, size_type p
         return priv::GetPositionFromCaseFolded(*this, findPos);
 }
 
-String GD_CORE_API operator+(String lhs, const String &rhs)
+String GD_CORE_API operator+(const String &lhs, const String &rhs)
+{
+    return String::Concat(lhs, rhs);
+}
+
+String GD_CORE_API operator+(String &&lhs, const String &rhs)
 {
     lhs += rhs;
-    return lhs;
+    return std::move(lhs);
+}
+
+String GD_CORE_API operator+(const String &lhs, String &&rhs)
+{
+    //Insert at the beginning of the temporary string, to reuse its memory.
+    rhs.insert(0, lhs);
+    return std::move(rhs);
 }
 
-String GD_CORE_API operator+(String lhs, const char *rhs)
+String GD_CORE_API operator+(String &&lhs, String &&rhs)
 {
     lhs += rhs;
-    return lhs;
+    return std::move(lhs);
+}
+
+String GD_CORE_API operator+(const String &lhs, const char *rhs)
+{
+    return String::Concat(lhs, rhs);
+}
+
+String GD_CORE_API operator+(String &&lhs, const char *rhs)
+{
+    lhs += rhs;
+    return std::move(lhs);
 }
 
 String GD_CORE_API operator+(const char *lhs, const String &rhs)
 {
-    String str(lhs);
-    str += rhs;
-    return str;
+    return String::Concat(lhs, rhs);
+}
+
+String GD_CORE_API operator+(const char *lhs, String &&rhs)
+{
+    rhs.insert(0, lhs);
+    return std::move(rhs);
 }
 
 const String& GD_CORE_API operator||(const String& lhs, const String &rhs)
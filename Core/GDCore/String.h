@@ -7,6 +7,8 @@
 #ifndef GDCORE_UTF8_STRING_H
 #define GDCORE_UTF8_STRING_H
 
+#include <atomic>
+#include <cstring>
 #include <functional>
 #include <iostream>
 #include <iterator>
@@ -118,6 +120,14 @@ public:
      */
     String(const std::u32string &string);
 
+    String(const String &other);
+
+    /**
+     * Constructs a String by moving the content of another one. The other
+     * String is left empty.
+     */
+    String(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -140,6 +150,10 @@ public:
 
     String& operator=(const std::u32string &string);
 
+    String& operator=(const String &other);
+
+    String& operator=(String &&other) noexcept;
+
 /**
  * \}
  */
@@ -156,8 +170,20 @@ public:
 
     /**
      * \brief Returns the string's length.
+     *
+     * The length is cached: it's only computed, in linear time (or constant
+     * time if the string is only made of ASCII characters), the first time
+     * it's requested after the string was modified.
      */
-    size_type size() const;
+    size_type size() const
+    {
+        size_type cachedSize = m_size.load(std::memory_order_relaxed);
+        if (cachedSize != npos) return cachedSize;
+
+        cachedSize = ComputeSize();
+        m_size.store(cachedSize, std::memory_order_relaxed);
+        return cachedSize;
+    }
 
     /**
      * \brief Returns the string's length.
@@ -169,7 +195,7 @@ public:
      *
      * **Iterators :** Obviously, all iterators are invalidated.
      */
-    void clear() { m_string.clear(); }
+    void clear() { m_string.clear(); m_size.store(0, std::memory_order_relaxed); }
 
     void reserve(gd::String::size_type size) { m_string.reserve(size); }
 
@@ -335,16 +361,21 @@ public:
 
     /**
      * \brief Returns the code point at the specified position
-     * \warning This operator has a linear complexity on the character's
-     * position. You should avoid to use it in a loop and use the iterators
-     * provided by this class instead.
+     * \warning This operator has a constant complexity only if the string is
+     * made of ASCII characters. Otherwise, it has a linear complexity on the
+     * character's position: you should avoid to use it in a loop and use the
+     * iterators provided by this class instead.
      */
     value_type operator[]( const size_type position ) const;
 
     /**
      * \brief Get the raw UTF8-encoded std::string
+     *
+     * \warning The cached length of the string is reset when this is called,
+     * as the raw string can be modified. Don't call size() while modifying the
+     * returned string.
      */
-    std::string& Raw() { return m_string; }
+    std::string& Raw() { m_size.store(npos, std::memory_order_relaxed); return m_string; }
 
     /**
      * \brief Get the raw UTF8-encoded std::string
@@ -371,6 +402,27 @@ public:
 
     String& operator+=( value_type character );
 
+    /**
+     * \brief Return the concatenation of all the given strings (gd::String or
+     * C-strings encoded in UTF8), allocating the result only once.
+     *
+     * Prefer it to a chain of operator+ to build a string from many parts, as
+     * each operator+ can reallocate the string.
+     *
+     * **Usage:**
+     * \code
+     * gd::String call = gd::String::Concat(functionName, "(", arguments, ")");
+     * \endcode
+     */
+    template<typename... Parts>
+    static String Concat( const Parts &... parts )
+    {
+        String str;
+        str.m_string.reserve(GetRawSize(parts...));
+        str.Append(parts...);
+        return str;
+    }
+
     /**
      * \brief Add a character (from its codepoint) at the end of the String.
      *
@@ -675,7 +727,62 @@ public:
  */
 
 private:
+    /**
+     * \brief Count the code points of the string.
+     */
+    size_type ComputeSize() const;
+
+    /**
+     * \name Concatenation helpers (see Concat)
+     * \{
+     */
+    static std::string::size_type GetRawSize() { return 0; }
+
+    template<typename... Parts>
+    static std::string::size_type GetRawSize( const String &part, const Parts &... parts )
+    {
+        return part.m_string.size() + GetRawSize(parts...);
+    }
+
+    template<typename... Parts>
+    static std::string::size_type GetRawSize( const char *part, const Parts &... parts )
+    {
+        return std::strlen(part) + GetRawSize(parts...);
+    }
+
+    void Append() {}
+
+    template<typename Part, typename... Parts>
+    void Append( const Part &part, const Parts &... parts )
+    {
+        *this += part;
+        Append(parts...);
+    }
+    /**
+     * \}
+     */
+
+    /**
+     * \brief Return true if the string is only made of ASCII characters, so
+     * that positions are the same as the positions of the bytes in the raw
+     * string.
+     */
+    bool IsASCII() const { return size() == m_string.size(); }
+
+    /**
+     * \brief Return the position in the raw string of the first byte of the
+     * character at **position** (which must not be greater than the size).
+     */
+    std::string::size_type GetBytePosition( size_type position ) const;
+
+    /**
+     * \brief Return the position of the character starting at the byte
+     * **bytePosition** of the raw string.
+     */
+    size_type GetPositionFromBytePosition( std::string::size_type bytePosition ) const;
+
     std::string m_string; ///< Internal std::string container
+    mutable std::atomic<size_type> m_size; ///< The cached length of the string, or npos if it must be computed again.
 
 };
 
@@ -687,15 +794,30 @@ private:
 /**
  * \relates String
  * \return a String containing the concatenation of lhs and rhs.
+ *
+ * \note The overloads taking a temporary String reuse its memory for the
+ * result, instead of allocating a new string.
  */
-String GD_CORE_API operator+(String lhs, const String &rhs);
+String GD_CORE_API operator+(const String &lhs, const String &rhs);
+
+///\relates String
+String GD_CORE_API operator+(String &&lhs, const String &rhs);
+
+///\relates String
+String GD_CORE_API operator+(const String &lhs, String &&rhs);
+
+///\relates String
+String GD_CORE_API operator+(String &&lhs, String &&rhs);
 
 /**
  * \relates String
  * \return a String containing the concatenation of lhs and rhs (rhs is
  * converted to gd::String assuming it's encoded in UTF8).
  */
-String GD_CORE_API operator+(String lhs, const char *rhs);
+String GD_CORE_API operator+(const String &lhs, const char *rhs);
+
+///\relates String
+String GD_CORE_API operator+(String &&lhs, const char *rhs);
 
 /**
  * \relates String
@@ -704,6 +826,9 @@ String GD_CORE_API operator+(String lhs, const char *rhs);
  */
 String GD_CORE_API operator+(const char *lhs, const String &rhs);
 
+///\relates String
+String GD_CORE_API operator+(const char *lhs, String &&rhs);
+
 const String& GD_CORE_API operator||(const String &lhs, const String &rhs);
 
 String GD_CORE_API operator||(String lhs, const char *rhs);
@@ -858,7 +983,8 @@ namespace std
  * The UTF8 encoding has the advantage to reduce the RAM consumption compared to UTF16 or UTF32 for strings using a lot
  * of latin characters. But the characters variable length brings some performance issues compared to fixed size encoding.
  * That's why the complexity of each methods is written in their documentation. For instance, the size() method is linear
- * on the string size and so is the operator[]().
+ * on the string size (but its result is cached until the string is modified) and so is the operator[]() (unless the
+ * string is only made of ASCII characters).
  *
  * \section Conversion Conversions from/to other string types
  * The String handles implicit conversion with std::String (implicit constructor and implicit conversion
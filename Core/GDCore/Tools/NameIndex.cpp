@@ -0,0 +1,13 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/NameIndex.h"
+
+namespace gd {
+
+constexpr std::size_t NameIndex::minimumItemsCount;
+std::size_t NameIndex::namesGeneration = 0;
+
+}  // namespace gd
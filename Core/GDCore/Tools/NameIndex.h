@@ -0,0 +1,185 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_NAMEINDEX_H
+#define GDCORE_NAMEINDEX_H
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An index of the positions of named items stored in a std::vector,
+ * used by the containers of the project (objects, layouts, resources,
+ * variables...) to find an item by its name in O(1).
+ *
+ * The index is built on the first lookup, and must be kept in sync by the
+ * container:
+ * - when an item is inserted, by calling NameIndex::Add,
+ * - when items are removed, renamed or reordered, by calling
+ * NameIndex::Invalidate.
+ *
+ * Items being renamed without their container knowing it, they must call
+ * NameIndex::NotifyNameChanged when their name is changed - except when they
+ * are given a name for the first time: items without a name are checked
+ * again when a name is not found. As the vector can also be modified
+ * directly, the index is rebuilt if the number of items changed, and a found
+ * position is always checked.
+ *
+ * Lookups can be done concurrently from several threads (the index being
+ * built only once), as long as the container is not modified at the same
+ * time.
+ *
+ * \note Under a few items, no index is built (a linear search is fast
+ * enough).
+ */
+class GD_CORE_API NameIndex {
+ public:
+  NameIndex()
+      : built(false), builtItemsCount(0), builtNamesGeneration(0){};
+
+  /**
+   * \brief Copying an index gives an empty index, as the copy is used
+   * for another vector.
+   */
+  NameIndex(const NameIndex&) : NameIndex(){};
+  NameIndex& operator=(const NameIndex&) {
+    Invalidate();
+    return *this;
+  };
+
+  /**
+   * \brief Return the position of the first item called \a name in \a items,
+   * or gd::String::npos if not found.
+   *
+   * \param getName A function returning the name of an item.
+   */
+  template <typename T, typename GetNameFn>
+  std::size_t Find(const std::vector<T>& items,
+                   const gd::String& name,
+                   GetNameFn getName) const {
+    if (items.size() < minimumItemsCount) {
+      for (std::size_t i = 0; i < items.size(); ++i)
+        if (getName(items[i]) == name) return i;
+
+      return gd::String::npos;
+    }
+
+    if (!IsUpToDate(items.size())) Build(items, getName, false);
+
+    std::size_t position = FindInIndex(name);
+    if (position == gd::String::npos) {
+      // Items without a name when the index was built may have been named
+      // since then.
+      bool unnamedItemWasNamed = false;
+      for (std::size_t unnamedPosition : unnamedPositions) {
+        if (unnamedPosition < items.size() &&
+            !getName(items[unnamedPosition]).empty()) {
+          unnamedItemWasNamed = true;
+          break;
+        }
+      }
+      if (!unnamedItemWasNamed) return gd::String::npos;
+    } else if (position < items.size() && getName(items[position]) == name) {
+      return position;
+    }
+
+    // The vector was modified without the index being invalidated.
+    Build(items, getName, true);
+    return FindInIndex(name);
+  }
+
+  /**
+   * \brief Update the index after an item called \a name was inserted at
+   * \a position in \a items.
+   *
+   * The index is kept if the item was appended, and invalidated otherwise.
+   */
+  template <typename T>
+  void Add(const std::vector<T>& items,
+           std::size_t position,
+           const gd::String& name) {
+    if (!built || position != builtItemsCount ||
+        position + 1 != items.size()) {
+      Invalidate();
+      return;
+    }
+
+    positions.emplace(name, position);
+    if (name.empty()) unnamedPositions.push_back(position);
+    builtItemsCount++;
+  }
+
+  /**
+   * \brief Invalidate the index, after items were removed, renamed or
+   * reordered.
+   */
+  void Invalidate() {
+    built = false;
+    positions.clear();
+    unnamedPositions.clear();
+  }
+
+  /**
+   * \brief Invalidate all the indices, to be called when an item having a
+   * name is renamed.
+   */
+  static void NotifyNameChanged() { namesGeneration++; }
+
+ private:
+  template <typename T, typename GetNameFn>
+  void Build(const std::vector<T>& items,
+             GetNameFn getName,
+             bool force) const {
+    std::lock_guard<std::mutex> lock(buildMutex);
+    // Another thread may have built the index while waiting for the lock.
+    if (!force && IsUpToDate(items.size())) return;
+
+    built = false;
+    positions.clear();
+    unnamedPositions.clear();
+    positions.reserve(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      const gd::String& name = getName(items[i]);
+      positions.emplace(name, i);  // Keep the first position.
+      if (name.empty()) unnamedPositions.push_back(i);
+    }
+
+    builtItemsCount = items.size();
+    builtNamesGeneration = namesGeneration;
+    built = true;
+  }
+
+  bool IsUpToDate(std::size_t itemsCount) const {
+    return built && builtItemsCount == itemsCount &&
+           builtNamesGeneration == namesGeneration;
+  }
+
+  std::size_t FindInIndex(const gd::String& name) const {
+    auto it = positions.find(name);
+    return it != positions.end() ? it->second : gd::String::npos;
+  }
+
+  static constexpr std::size_t minimumItemsCount = 16;
+
+  mutable std::atomic<bool> built;  ///< true if positions can be used.
+  mutable std::mutex buildMutex;  ///< Held while the index is built.
+  mutable std::size_t builtItemsCount;  ///< The size of the indexed vector.
+  mutable std::size_t builtNamesGeneration;
+  mutable std::unordered_map<gd::String, std::size_t> positions;
+  mutable std::vector<std::size_t> unnamedPositions;
+
+  static std::size_t
+      namesGeneration;  ///< Incremented when an item is renamed.
+};
+
+}  // namespace gd
+
+#endif  // GDCORE_NAMEINDEX_H
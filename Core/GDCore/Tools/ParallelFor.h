@@ -0,0 +1,55 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_PARALLELFOR_H
+#define GDCORE_PARALLELFOR_H
+#include <algorithm>
+#include <cstddef>
+#if !defined(EMSCRIPTEN)
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+namespace gd {
+
+/**
+ * \brief Call \a fn with each index from 0 to \a count - 1, using a pool of
+ * threads on native builds.
+ *
+ * The calls are done in no particular order and \a fn must be safe to call
+ * concurrently: results should be stored in a slot per index, and merged
+ * in order after the call if the result must be deterministic.
+ *
+ * \note The calls are done sequentially on the calling thread when built with
+ * Emscripten (no threads are available), or when there is a single core.
+ */
+template <typename Fn>
+void ParallelFor(std::size_t count, Fn fn) {
+#if !defined(EMSCRIPTEN)
+  std::size_t threadsCount =
+      std::min<std::size_t>(std::thread::hardware_concurrency(), count);
+  if (threadsCount > 1) {
+    std::atomic<std::size_t> nextIndex(0);
+    auto work = [&]() {
+      for (std::size_t i = nextIndex++; i < count; i = nextIndex++) fn(i);
+    };
+
+    // The calling thread is one of the workers.
+    std::vector<std::thread> threads;
+    for (std::size_t i = 1; i < threadsCount; ++i) threads.emplace_back(work);
+    work();
+    for (auto& thread : threads) thread.join();
+    return;
+  }
+#endif
+
+  for (std::size_t i = 0; i < count; ++i) fn(i);
+}
+
+}  // namespace gd
+
+#endif  // GDCORE_PARALLELFOR_H
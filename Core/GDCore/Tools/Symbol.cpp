@@ -0,0 +1,60 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Symbol.h"
+
+#include <mutex>
+#include <unordered_set>
+
+namespace {
+/**
+ * A part of the table of the interned strings. The table is split in
+ * several parts, each with its own lock, so that threads interning different
+ * strings rarely wait for each other.
+ */
+struct SymbolTableShard {
+  std::mutex mutex;
+  std::unordered_set<gd::String> strings;  ///< Elements are never moved.
+};
+
+constexpr std::size_t shardsCount = 16;
+
+SymbolTableShard& GetShard(const gd::String& str) {
+  static SymbolTableShard shards[shardsCount];
+  return shards[std::hash<gd::String>()(str) % shardsCount];
+}
+}  // namespace
+
+namespace gd {
+
+const gd::String& Symbol::GetEmptyString() {
+  static const gd::String emptyString;
+  return emptyString;
+}
+
+const gd::String& Symbol::Intern(const gd::String& str) {
+  if (str.empty()) return GetEmptyString();
+
+  SymbolTableShard& shard = GetShard(str);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return *shard.strings.insert(str).first;
+}
+
+bool Symbol::FindExisting(const gd::String& str, Symbol& symbol) {
+  if (str.empty()) {
+    symbol = Symbol();
+    return true;
+  }
+
+  SymbolTableShard& shard = GetShard(str);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.strings.find(str);
+  if (it == shard.strings.end()) return false;
+
+  symbol.string = &*it;
+  return true;
+}
+
+}  // namespace gd
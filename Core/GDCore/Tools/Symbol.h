@@ -0,0 +1,92 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+
+#ifndef GDCORE_SYMBOL_H
+#define GDCORE_SYMBOL_H
+#include <functional>
+
+#include "GDCore/String.h"
+
+namespace gd {
+
+/**
+ * \brief An interned identifier (an object, behavior or instruction type
+ * name...): all the symbols made from the same string share a single copy of
+ * it, stored in a global table.
+ *
+ * Symbols are compared and hashed by their address, without reading the
+ * strings, which makes them cheap to copy and fast to use as keys of hash
+ * tables. They are converted to a gd::String (without any copy) at the
+ * serialization and bindings boundaries.
+ *
+ * \note Interned strings are never freed: only use symbols for identifiers,
+ * not for arbitrary texts.
+ *
+ * Symbols can be created, copied and compared from several threads.
+ */
+class GD_CORE_API Symbol {
+ public:
+  /**
+   * \brief Construct the symbol of an empty string.
+   */
+  Symbol() : string(&GetEmptyString()){};
+
+  /**
+   * \brief Construct the symbol of the given string, interning it if
+   * necessary.
+   */
+  explicit Symbol(const gd::String& str) : string(&Intern(str)){};
+
+  /**
+   * \brief Search for the symbol of the given string, without interning it.
+   *
+   * \return true if the string was already interned (and set \a symbol to its
+   * symbol), false otherwise. In this case, no symbol can be equal to it.
+   */
+  static bool FindExisting(const gd::String& str, Symbol& symbol);
+
+  /**
+   * \brief Return the string of the symbol.
+   */
+  const gd::String& GetString() const { return *string; };
+  operator const gd::String&() const { return *string; };
+
+  bool empty() const { return string->empty(); };
+
+  bool operator==(const Symbol& other) const { return string == other.string; };
+  bool operator!=(const Symbol& other) const { return string != other.string; };
+
+  /**
+   * \brief Compare the strings of the symbols, so that the order does not
+   * depend on the order of interning.
+   */
+  bool operator<(const Symbol& other) const {
+    return string != other.string && *string < *other.string;
+  };
+
+ private:
+  static const gd::String& Intern(const gd::String& str);
+  static const gd::String& GetEmptyString();
+
+  const gd::String* string;  ///< The interned string, shared by the symbols.
+};
+
+}  // namespace gd
+
+namespace std {
+/**
+ * std::hash specialization for gd::Symbol, hashing the address of the interned
+ * string.
+ */
+template <>
+struct hash<gd::Symbol> {
+  size_t operator()(const gd::Symbol& symbol) const {
+    return hash<const gd::String*>()(&symbol.GetString());
+  }
+};
+}  // namespace std
+
+#endif  // GDCORE_SYMBOL_H
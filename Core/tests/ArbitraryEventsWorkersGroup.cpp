@@ -0,0 +1,136 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/Events/ArbitraryEventsWorkersGroup.h"
+
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Log the instructions it visits and optionally delete some of them.
+ */
+class InstructionsLogger : public gd::ArbitraryEventsWorker {
+ public:
+  InstructionsLogger(const gd::String &name_,
+                     std::vector<gd::String> &log_,
+                     const gd::String &deletedType_ = "")
+      : name(name_), log(log_), deletedType(deletedType_){};
+  virtual ~InstructionsLogger(){};
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    log.push_back(name + ":" + instruction.GetType());
+    return instruction.GetType() == deletedType;
+  }
+
+  gd::String name;
+  std::vector<gd::String> &log;
+  gd::String deletedType;
+};
+
+/**
+ * Count the instructions it visits with a context, stopping after a maximum.
+ */
+class ReadOnlyInstructionsCounter
+    : public gd::ReadOnlyArbitraryEventsWorkerWithContext {
+ public:
+  ReadOnlyInstructionsCounter(std::size_t maximumCount_)
+      : maximumCount(maximumCount_){};
+  virtual ~ReadOnlyInstructionsCounter(){};
+
+  std::size_t count = 0;
+  const gd::ProjectScopedContainers *context = nullptr;
+
+ private:
+  void DoVisitInstruction(const gd::Instruction &instruction,
+                          bool isCondition) override {
+    context = &GetProjectScopedContainers();
+    count++;
+    if (count >= maximumCount) StopAnyEventIteration();
+  }
+
+  std::size_t maximumCount;
+};
+
+void InsertEventWithActions(gd::EventsList &events,
+                            const std::vector<gd::String> &types) {
+  gd::StandardEvent event;
+  for (auto &type : types) {
+    gd::Instruction action;
+    action.SetType(type);
+    event.GetActions().Insert(action);
+  }
+  events.InsertEvent(event);
+}
+}  // namespace
+
+TEST_CASE("ArbitraryEventsWorkersGroup", "[common][events]") {
+  SECTION("Launch the workers in a single traversal, in order") {
+    gd::EventsList events;
+    InsertEventWithActions(events, {"A", "B"});
+    InsertEventWithActions(events, {"C"});
+
+    std::vector<gd::String> log;
+    InstructionsLogger firstWorker("1", log);
+    InstructionsLogger secondWorker("2", log);
+    gd::ArbitraryEventsWorkersGroup group;
+    group.AddWorker(firstWorker).AddWorker(secondWorker);
+    REQUIRE(group.GetWorkersCount() == 2);
+
+    group.Launch(events);
+    REQUIRE(log == (std::vector<gd::String>{"1:A", "2:A", "1:B", "2:B", "1:C",
+                                            "2:C"}));
+  }
+
+  SECTION("Don't give deleted instructions to the next workers") {
+    gd::EventsList events;
+    InsertEventWithActions(events, {"A", "B", "C"});
+
+    std::vector<gd::String> log;
+    InstructionsLogger firstWorker("1", log, "B");
+    InstructionsLogger secondWorker("2", log);
+    gd::ArbitraryEventsWorkersGroup group;
+    group.AddWorker(firstWorker).AddWorker(secondWorker);
+
+    group.Launch(events);
+    REQUIRE(log ==
+            (std::vector<gd::String>{"1:A", "2:A", "1:B", "1:C", "2:C"}));
+    auto &event = dynamic_cast<gd::StandardEvent &>(events.GetEvent(0));
+    REQUIRE(event.GetActions().size() == 2);
+    REQUIRE(event.GetActions()[1].GetType() == "C");
+  }
+
+  SECTION("Give the context to the workers and stop them independently") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    InsertEventWithActions(layout.GetEvents(), {"A", "B", "C"});
+
+    ReadOnlyInstructionsCounter firstCounter(1);
+    ReadOnlyInstructionsCounter secondCounter(100);
+    gd::ReadOnlyArbitraryEventsWorkersGroupWithContext group;
+    group.AddWorker(firstCounter).AddWorker(secondCounter);
+
+    auto projectScopedContainers = gd::ProjectScopedContainers::
+        MakeNewProjectScopedContainersForProjectAndLayout(project, layout);
+    group.Launch(layout.GetEvents(), projectScopedContainers);
+    REQUIRE(firstCounter.count == 1);
+    REQUIRE(secondCounter.count == 3);
+    REQUIRE(firstCounter.context == &projectScopedContainers);
+    REQUIRE(secondCounter.context == &projectScopedContainers);
+  }
+}
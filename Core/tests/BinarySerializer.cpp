@@ -0,0 +1,221 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+/**
+ * @file Tests covering serialization to the binary format.
+ */
+#include "GDCore/Serialization/BinarySerializer.h"
+
+#include <cstring>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/Variable.h"
+#include "GDCore/Serialization/BinarySerializerReader.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "catch.hpp"
+
+using namespace gd;
+
+namespace {
+gd::String ToJSONThroughBinary(const gd::String &json) {
+  SerializerElement element = Serializer::FromJSON(json);
+  std::vector<char> binary = BinarySerializer::ToBinary(element);
+  return Serializer::ToJSON(BinarySerializer::FromBinary(binary));
+}
+}  // namespace
+
+TEST_CASE("BinarySerializer", "[common]") {
+  SECTION("Lossless conversion of JSON") {
+    std::vector<gd::String> jsons = {
+        "\"\"",
+        "123.455",
+        "{}",
+        "[]",
+        "[1,2]",
+        "{\"ok\":true,\"hello\":\"world\"}",
+        "{\"a\":1,\"b\":{\"c\":2}}",
+        "{\"hello\":{\"world\":[{},[],3,\"4\"],\"world2\":[-1,\"-2\","
+        "{\"-3\":[-4]}]}}",
+        "{\"\\\"hello\\\"\":\" \\\"quote\\\" \",\"caret-prop\":"
+        "1,\"special-\\b\\f\\n\\r\\t\\\"\":\"\\b\\f\\n\\r\\t\"}",
+        u8"{\"Ich heiße GDevelop\":\"Gut!\",\"Bonjour à tout le monde\":"
+        u8"1,\"Hello 官话 world\":\"官话\"}",
+    };
+    for (const auto &json : jsons) {
+      REQUIRE(ToJSONThroughBinary(json) == json);
+    }
+  }
+
+  SECTION("Types, attributes and arrays are preserved") {
+    SerializerElement element;
+    element.SetStringAttribute("attr1", "attr123");
+    element.SetIntAttribute("attr2", 42);
+    element.AddChild("bool").SetBoolValue(true);
+    element.AddChild("int").SetIntValue(-45);
+    element.AddChild("double").SetDoubleValue(45.6);
+    element.AddChild("string").SetStringValue("45");
+    auto &array = element.AddChild("array");
+    array.ConsiderAsArrayOf("item");
+    array.AddChild("item").SetStringValue("first");
+    array.AddChild("item").SetStringValue("second");
+
+    SerializerElement readElement =
+        BinarySerializer::FromBinary(BinarySerializer::ToBinary(element));
+    REQUIRE(readElement.GetStringAttribute("attr1") == "attr123");
+    REQUIRE(readElement.GetIntAttribute("attr2") == 42);
+    REQUIRE(readElement.GetChild("bool").GetValue().IsBoolean());
+    REQUIRE(readElement.GetChild("int").GetValue().IsInt());
+    REQUIRE(readElement.GetChild("int").GetIntValue() == -45);
+    REQUIRE(readElement.GetChild("double").GetValue().IsDouble());
+    REQUIRE(readElement.GetChild("double").GetDoubleValue() == 45.6);
+    REQUIRE(readElement.GetChild("string").GetValue().IsString());
+    REQUIRE(readElement.GetChild("array").ConsideredAsArrayOf() == "item");
+    REQUIRE(readElement.GetChild("array").GetChildrenCount() == 2);
+    REQUIRE(readElement.GetChild("array").GetChild(1).GetStringValue() ==
+            "second");
+    REQUIRE(Serializer::ToJSON(readElement) == Serializer::ToJSON(element));
+  }
+
+  SECTION("Lossless conversion of a project") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    project.GetVariables().InsertNew("MyGlobalVariable", 0).SetValue(123);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    layout.GetVariables().InsertNew("MyVariable", 0).SetString(u8"官话");
+    gd::StandardEvent event;
+    gd::Instruction action;
+    action.SetType("MyExtension::DoSomething");
+    action.SetParametersCount(1);
+    action.SetParameter(0, gd::Expression("1+MyObject.X()"));
+    event.GetActions().Insert(action);
+    layout.GetEvents().InsertEvent(event);
+
+    SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    std::vector<char> binary = BinarySerializer::ToBinary(projectElement);
+    SerializerElement readElement = BinarySerializer::FromBinary(binary);
+    REQUIRE(Serializer::ToJSON(readElement) ==
+            Serializer::ToJSON(projectElement));
+
+    // Loading a project from the binary data is the same as loading it
+    // from JSON.
+    gd::Project projectFromJSON;
+    projectFromJSON.AddPlatform(platform);
+    projectFromJSON.UnserializeFrom(
+        Serializer::FromJSON(Serializer::ToJSON(projectElement)));
+    gd::Project projectFromBinary;
+    projectFromBinary.AddPlatform(platform);
+    projectFromBinary.UnserializeFrom(readElement);
+
+    SerializerElement elementFromJSON;
+    projectFromJSON.SerializeTo(elementFromJSON);
+    SerializerElement elementFromBinary;
+    projectFromBinary.SerializeTo(elementFromBinary);
+    REQUIRE(Serializer::ToJSON(elementFromBinary) ==
+            Serializer::ToJSON(elementFromJSON));
+  }
+
+  SECTION("Transfer an element through a buffer") {
+    SerializerElement element = Serializer::FromJSON(
+        "{\"a\":1,\"b\":{\"c\":\"hello\"},\"d\":[true,2.5]}");
+    BinarySerializerBuffer buffer;
+    buffer.Serialize(element);
+    REQUIRE(buffer.GetData() == BinarySerializer::ToBinary(element));
+    REQUIRE(buffer.GetSize() == buffer.GetData().size());
+
+    // Write the data directly at the address of another buffer, as done
+    // from JavaScript in the memory of the WebAssembly module.
+    BinarySerializerBuffer writtenBuffer;
+    writtenBuffer.Resize(buffer.GetSize());
+    std::memcpy(reinterpret_cast<char *>(writtenBuffer.GetDataAddress()),
+                buffer.GetData().data(),
+                buffer.GetSize());
+    REQUIRE(Serializer::ToJSON(writtenBuffer.Unserialize()) ==
+            Serializer::ToJSON(element));
+
+    SerializerElement unserializedElement = Serializer::FromJSON("{\"e\":3}");
+    writtenBuffer.UnserializeTo(unserializedElement);
+    REQUIRE(Serializer::ToJSON(unserializedElement) ==
+            Serializer::ToJSON(element));
+  }
+
+  SECTION("Invalid data") {
+    std::vector<char> binary = BinarySerializer::ToBinary(
+        Serializer::FromJSON("{\"a\":1,\"b\":{\"c\":\"hello\"}}"));
+
+    REQUIRE(BinarySerializer::FromBinary("", 0).IsValueUndefined());
+    REQUIRE(BinarySerializer::FromBinary("GDSB\2\0\0\0", 8)
+                .GetAllChildren()
+                .empty());
+
+    // Truncated data can't be read past its end.
+    for (std::size_t size = 0; size < binary.size(); ++size) {
+      BinarySerializerReader reader(binary.data(), size);
+      REQUIRE(reader.GetRootElement()
+                  .GetChild("b")
+                  .GetChild("c")
+                  .GetStringValue() != "hello");
+    }
+  }
+}
+
+TEST_CASE("BinarySerializerReader", "[common]") {
+  SerializerElement element = Serializer::FromJSON(
+      "{\"name\":\"MyGame\",\"count\":3,\"ratio\":0.5,\"enabled\":true,"
+      "\"layouts\":[{\"name\":\"Scene1\",\"objects\":[]},"
+      "{\"name\":\"Scene2\",\"objects\":[{\"name\":\"Player\"}]}]}");
+  std::vector<char> binary = BinarySerializer::ToBinary(element);
+  BinarySerializerReader reader(binary.data(), binary.size());
+  REQUIRE(reader.IsValid());
+
+  SECTION("Values and attributes") {
+    BinarySerializedElement root = reader.GetRootElement();
+    REQUIRE(root.IsValid());
+    REQUIRE(root.IsValueUndefined());
+    REQUIRE(root.GetChild("name").GetStringValue() == "MyGame");
+    REQUIRE(root.GetChild("count").GetIntValue() == 3);
+    REQUIRE(root.GetChild("ratio").GetDoubleValue() == 0.5);
+    REQUIRE(root.GetChild("enabled").GetBoolValue() == true);
+
+    // Attribute getters also search in children, like gd::SerializerElement.
+    REQUIRE(root.GetStringAttribute("name") == "MyGame");
+    REQUIRE(root.GetIntAttribute("count") == 3);
+    REQUIRE(root.GetDoubleAttribute("ratio") == 0.5);
+    REQUIRE(root.GetBoolAttribute("enabled") == true);
+    REQUIRE(root.GetStringAttribute("missing", "default") == "default");
+    REQUIRE(root.HasAttribute("name") == false);
+  }
+
+  SECTION("Children") {
+    BinarySerializedElement root = reader.GetRootElement();
+    REQUIRE(root.HasChild("layouts"));
+    REQUIRE(!root.HasChild("missing"));
+    REQUIRE(!root.GetChild("missing").IsValid());
+
+    BinarySerializedElement layouts = root.GetChild("layouts");
+    REQUIRE(layouts.ConsideredAsArray());
+    REQUIRE(layouts.GetChildrenCount() == 2);
+    REQUIRE(layouts.GetChild(0).GetStringAttribute("name") == "Scene1");
+    REQUIRE(layouts.GetChild(1).GetStringAttribute("name") == "Scene2");
+    REQUIRE(!layouts.GetChild(2).IsValid());
+    REQUIRE(layouts.GetChild(1)
+                .GetChild("objects")
+                .GetChild(0)
+                .GetStringAttribute("name") == "Player");
+
+    SerializerElement layoutElement =
+        layouts.GetChild(1).ToSerializerElement();
+    REQUIRE(Serializer::ToJSON(layoutElement) ==
+            "{\"name\":\"Scene2\",\"objects\":[{\"name\":\"Player\"}]}");
+  }
+}
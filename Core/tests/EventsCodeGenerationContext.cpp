@@ -132,6 +132,21 @@ TEST_CASE("EventsCodeGenerationContext", "[common][events]") {
     REQUIRE(c5.GetLastDepthObjectListWasNeeded("c5.empty1") == 2);
   }
 
+  SECTION("Objects lists needed by a parent after inheriting are ignored") {
+    gd::EventsCodeGenerationContext c6;
+    c6.InheritsFrom(c4);
+    c4.ObjectsListNeeded("c4.object1");
+    c2.ObjectsListNeeded("c1.object1");
+
+    REQUIRE(c4.ObjectAlreadyDeclaredByParents("c1.object1") == true);
+    REQUIRE(c6.ObjectAlreadyDeclaredByParents("c4.object1") == false);
+    REQUIRE(c6.GetObjectsListsAlreadyDeclaredByParents() ==
+            std::set<gd::String>(
+                {"c1.object1", "c1.object2", "c1.noPicking1", "c2.object1"}));
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c1.object1") == 0);
+    REQUIRE(c6.GetLastDepthObjectListWasNeeded("c2.object1") == 1);
+  }
+
   SECTION("SetCurrentObject") {
     REQUIRE(c3.GetCurrentObject() == "");
     c3.SetCurrentObject("current object");
@@ -8,8 +8,13 @@
  */
 #include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
 #include <memory>
+#include "DummyPlatform.h"
 #include "GDCore/CommonTools.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
 #include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/Project/Layout.h"
 #include "GDCore/Project/Project.h"
 #include "GDCore/Tools/VersionWrapper.h"
@@ -31,4 +36,38 @@ TEST_CASE("EventsCodeGenerator", "[common][events]") {
     REQUIRE(codeGenerator.ConvertToString("{\"hello\":\r\n\"world \\\" \"}") ==
             "{\\\"hello\\\":\\r\\n\\\"world \\\\\\\" \\\"}");
   }
+
+  SECTION("Append the code of events lists to an existing output") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto& layout = project.InsertNewLayout("Layout 1", 0);
+    platform.GetExtension("BuiltinCommonInstructions")
+        ->GetAllEvents()["BuiltinCommonInstructions::Standard"]
+        .SetCodeGenerator([](gd::BaseEvent& event,
+                             gd::EventsCodeGenerator& codeGenerator,
+                             gd::EventsCodeGenerationContext& context) {
+          gd::String code = "event();";
+          codeGenerator.AppendEventsListCode(
+              event.GetSubEvents(), context, code);
+          return code;
+        });
+
+    gd::EventsList events;
+    gd::StandardEvent event;
+    event.SetType("BuiltinCommonInstructions::Standard");
+    event.GetSubEvents().InsertEvent(event);
+    events.InsertEvent(event);
+    events.InsertEvent(event);
+
+    gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+    gd::EventsCodeGenerationContext context;
+    gd::String code = codeGenerator.GenerateEventsListCode(events, context);
+    REQUIRE(code.find("event();") != gd::String::npos);
+
+    gd::EventsCodeGenerationContext otherContext;
+    gd::String output = "// Existing code";
+    codeGenerator.AppendEventsListCode(events, otherContext, output);
+    REQUIRE(output == "// Existing code" + code);
+  }
 }
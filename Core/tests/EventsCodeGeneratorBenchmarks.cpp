@@ -0,0 +1,167 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <memory>
+#include <numeric>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/EventMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Generate some code for the standard events, using the objects given as first
+ * parameter of their actions, followed by the code of their sub-events (like
+ * the standard event of a real platform does).
+ */
+void SetupStandardEventCodeGenerator(gd::Platform &platform) {
+  platform.GetExtension("BuiltinCommonInstructions")
+      ->GetAllEvents()["BuiltinCommonInstructions::Standard"]
+      .SetCodeGenerator([](gd::BaseEvent &event,
+                           gd::EventsCodeGenerator &codeGenerator,
+                           gd::EventsCodeGenerationContext &context) {
+        gd::String code = "if (someCondition()) {\n";
+        auto &actions = dynamic_cast<gd::StandardEvent &>(event).GetActions();
+        for (std::size_t i = 0; i < actions.size(); ++i) {
+          const gd::String &objectName =
+              actions[i].GetParameter(0).GetPlainString();
+          context.ObjectsListNeeded(objectName);
+          code += "  someAction(" +
+                  codeGenerator.GetObjectListName(objectName, context) +
+                  ");\n";
+        }
+        codeGenerator.AppendEventsListCode(event.GetSubEvents(), context, code);
+        code += "}\n";
+        return code;
+      });
+}
+
+gd::StandardEvent MakeStandardEvent() {
+  gd::StandardEvent event;
+  event.SetType("BuiltinCommonInstructions::Standard");
+  return event;
+}
+
+void InsertDeepEvents(gd::EventsList &events, std::size_t depth) {
+  gd::EventsList *currentEvents = &events;
+  for (std::size_t i = 0; i < depth; ++i) {
+    auto &event = currentEvents->InsertEvent(MakeStandardEvent());
+    currentEvents = &event.GetSubEvents();
+  }
+}
+
+void InsertWideEvents(gd::EventsList &events, std::size_t count) {
+  gd::StandardEvent eventWithSubEvents = MakeStandardEvent();
+  for (std::size_t i = 0; i < 5; ++i)
+    eventWithSubEvents.GetSubEvents().InsertEvent(MakeStandardEvent());
+
+  for (std::size_t i = 0; i < count; ++i) events.InsertEvent(eventWithSubEvents);
+}
+
+void InsertEventsUsingObjects(gd::EventsList &events,
+                              std::size_t count,
+                              std::size_t depth,
+                              std::size_t objectsCount) {
+  for (std::size_t i = 0; i < count; ++i) {
+    gd::EventsList *currentEvents = &events;
+    for (std::size_t j = 0; j < depth; ++j) {
+      gd::StandardEvent event = MakeStandardEvent();
+      for (std::size_t k = 0; k < 3; ++k) {
+        gd::String objectName =
+            "MyObject" + gd::String::From((i * 7 + j * 3 + k) % objectsCount);
+        event.GetActions().Insert(gd::Instruction(
+            "DoSomething", std::vector<gd::Expression>{objectName}));
+      }
+      auto &insertedEvent = currentEvents->InsertEvent(event);
+      currentEvents = &insertedEvent.GetSubEvents();
+    }
+  }
+}
+}  // namespace
+
+TEST_CASE("EventsCodeGenerator - Benchmarks", "[common][events]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  SetupStandardEventCodeGenerator(platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+
+  SECTION("Generate the code of deeply nested events") {
+    gd::EventsList events;
+    InsertDeepEvents(events, 200);
+
+    doBenchmark("Generate the code of 200 nested events", 10, [&]() {
+      gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+      gd::EventsCodeGenerationContext context;
+      gd::String code = codeGenerator.GenerateEventsListCode(events, context);
+      REQUIRE(!code.empty());
+    });
+  }
+
+  SECTION("Generate the code of a long list of events") {
+    gd::EventsList events;
+    InsertWideEvents(events, 2000);
+
+    doBenchmark("Generate the code of 2000 events with sub-events", 10, [&]() {
+      gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+      gd::EventsCodeGenerationContext context;
+      gd::String code = codeGenerator.GenerateEventsListCode(events, context);
+      REQUIRE(!code.empty());
+    });
+  }
+
+  SECTION("Generate the code of events using many objects") {
+    for (std::size_t i = 0; i < 300; ++i) {
+      layout.InsertNewObject(project,
+                             "MyExtension::Sprite",
+                             "MyObject" + gd::String::From(i),
+                             layout.GetObjectsCount());
+    }
+    gd::EventsList events;
+    InsertEventsUsingObjects(events, 500, 10, 300);
+
+    doBenchmark(
+        "Generate the code of 500 nested events using 300 objects", 10, [&]() {
+          gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+          gd::EventsCodeGenerationContext context;
+          gd::String code =
+              codeGenerator.GenerateEventsListCode(events, context);
+          REQUIRE(!code.empty());
+        });
+  }
+}
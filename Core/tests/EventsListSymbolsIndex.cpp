@@ -0,0 +1,138 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+gd::Instruction &InsertAction(gd::EventsList &events,
+                              const gd::String &type,
+                              size_t parameterIndex,
+                              const gd::String &parameter) {
+  gd::StandardEvent event;
+  gd::Instruction action;
+  action.SetType(type);
+  action.SetParametersCount(parameterIndex + 1);
+  action.SetParameter(parameterIndex, gd::Expression(parameter));
+  event.GetActions().Insert(action);
+
+  auto &insertedEvent =
+      dynamic_cast<gd::StandardEvent &>(events.InsertEvent(event));
+  return insertedEvent.GetActions()[0];
+}
+}  // namespace
+
+TEST_CASE("EventsList symbols index", "[common][events]") {
+  SECTION("Index the symbols used by events and their sub-events") {
+    gd::EventsList events;
+    InsertAction(events, "MyExtension::DoSomething", 0,
+                 "MyObject.X() + MyVariable.MyChild[\"hello world\"]");
+    auto &event = dynamic_cast<gd::StandardEvent &>(events.GetEvent(0));
+    InsertAction(event.GetSubEvents(), "MyExtension::SetCameraCenterX", 3,
+                 "\"My layer\"");
+
+    // Events without index may use anything.
+    REQUIRE(events.HasSymbolsIndex() == false);
+    REQUIRE(events.MayUseSymbol("MyOtherObject") == true);
+
+    events.IndexSymbols();
+    REQUIRE(events.HasSymbolsIndex() == true);
+    REQUIRE(events.MayUseSymbol("MyObject") == true);
+    REQUIRE(events.MayUseSymbol("MyVariable") == true);
+    REQUIRE(events.MayUseSymbol("MyChild") == true);
+    REQUIRE(events.MayUseSymbol("hello world") == true);
+    REQUIRE(events.MayUseSymbol("My layer") == true);
+    REQUIRE(events.MayUseSymbol("MyExtension::SetCameraCenterX") == true);
+    REQUIRE(events.MayUseSymbol("MyOtherObject") == false);
+    REQUIRE(events.MayUseSymbol("My other layer") == false);
+    REQUIRE(events.MayUseSymbol("My") == true);
+    REQUIRE(events.MayUseSymbol("Obj") == false);
+
+    gd::EventsList copiedEvents = events;
+    REQUIRE(copiedEvents.HasSymbolsIndex() == true);
+    REQUIRE(copiedEvents.MayUseSymbol("MyObject") == true);
+    REQUIRE(copiedEvents.MayUseSymbol("MyOtherObject") == false);
+
+    events.ClearSymbolsIndex();
+    REQUIRE(events.HasSymbolsIndex() == false);
+    REQUIRE(events.MayUseSymbol("MyOtherObject") == true);
+  }
+
+  SECTION("Only refactor the events lists that may use a renamed element") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("My layout", 0);
+    auto &otherLayout = project.InsertNewLayout("My other layout", 1);
+    auto &action = InsertAction(layout.GetEvents(), "MyExtension::Scene", 1,
+                                "\"My other layout\"");
+    auto &otherAction = InsertAction(otherLayout.GetEvents(),
+                                     "MyExtension::Scene", 1, "\"Menu\"");
+
+    gd::WholeProjectRefactorer::IndexEventsSymbols(project);
+    REQUIRE(layout.GetEvents().HasSymbolsIndex() == true);
+    REQUIRE(otherLayout.GetEvents().HasSymbolsIndex() == true);
+
+    // Modify the events without updating their index: they are now skipped
+    // by refactorings even if they use the renamed layout.
+    otherAction.SetParameter(1, gd::Expression("\"My other layout\""));
+
+    gd::WholeProjectRefactorer::RenameLayout(project, "My other layout",
+                                             "My renamed layout");
+    REQUIRE(action.GetParameter(1).GetPlainString() ==
+            "\"My renamed layout\"");
+    REQUIRE(otherAction.GetParameter(1).GetPlainString() ==
+            "\"My other layout\"");
+
+    // The index of the refactored events is updated.
+    REQUIRE(layout.GetEvents().MayUseSymbol("My renamed layout") == true);
+    REQUIRE(otherLayout.GetEvents().MayUseSymbol("My renamed layout") ==
+            false);
+
+    // Without index, all the events are refactored.
+    otherLayout.GetEvents().ClearSymbolsIndex();
+    gd::WholeProjectRefactorer::RenameLayout(project, "My other layout",
+                                             "My renamed layout");
+    REQUIRE(otherAction.GetParameter(1).GetPlainString() ==
+            "\"My renamed layout\"");
+  }
+
+  SECTION("Update the index of events after an object is renamed") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    auto &action = InsertAction(layout.GetEvents(), "MyExtension::DoSomething",
+                                0, "MyObject.GetObjectNumber() + 1");
+
+    gd::WholeProjectRefactorer::IndexEventsSymbols(project);
+    REQUIRE(layout.GetEvents().MayUseSymbol("MyRenamedObject") == false);
+
+    gd::WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
+        project, layout, "MyObject", "MyRenamedObject",
+        /* isObjectGroup =*/false);
+    REQUIRE(action.GetParameter(0).GetPlainString() ==
+            "MyRenamedObject.GetObjectNumber() + 1");
+    REQUIRE(layout.GetEvents().MayUseSymbol("MyRenamedObject") == true);
+
+    // The updated index allows to rename the object again.
+    layout.GetObject("MyObject").SetName("MyRenamedObject");
+    gd::WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
+        project, layout, "MyRenamedObject", "MyObject",
+        /* isObjectGroup =*/false);
+    REQUIRE(action.GetParameter(0).GetPlainString() ==
+            "MyObject.GetObjectNumber() + 1");
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionNodeArena.h"
+
+#include <memory>
+#include <thread>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "catch.hpp"
+
+TEST_CASE("ExpressionNodeArena", "[common][events]") {
+  const gd::String expression =
+      "MySpriteObject.X() + MyExtension::GetNumberWith2Params(12, \"hello "
+      "world\") * -MyVariable[\"Child\"].OtherChild + (1";
+
+  SECTION("Parse a tree outliving its arena") {
+    std::unique_ptr<gd::ExpressionNode> node;
+    {
+      gd::ExpressionParser2 parser;
+      parser.UseArenaAllocation(std::make_shared<gd::ExpressionNodeArena>());
+      node = parser.ParseExpression(expression);
+    }
+
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            gd::ExpressionParser2NodePrinter::PrintNode(
+                *gd::ExpressionParser2().ParseExpression(expression)));
+
+    // Diagnostics are allocated from the arena too.
+    gd::ExpressionParser2 parser;
+    parser.UseArenaAllocation(std::make_shared<gd::ExpressionNodeArena>());
+    auto textNode = parser.ParseExpression("\"Unfinished text");
+    REQUIRE(textNode->diagnostic != nullptr);
+    REQUIRE(textNode->diagnostic->IsError());
+  }
+
+  SECTION("Parse trees allocated from a shared arena") {
+    auto arena = std::make_shared<gd::ExpressionNodeArena>(64 * 1024);
+    gd::ExpressionParser2 parser;
+    parser.UseArenaAllocation(arena);
+    auto firstNode = parser.ParseExpression(expression);
+    auto secondNode = parser.ParseExpression("1 + 2");
+    REQUIRE(arena->GetBlocksCount() == 1);
+    arena.reset();
+    parser = gd::ExpressionParser2();
+
+    // Move a node allocated from the arena to a tree allocated separately,
+    // and destroy it from another thread.
+    auto heapNode = gd::ExpressionParser2().ParseExpression("3 + 4");
+    auto &heapOperatorNode = dynamic_cast<gd::OperatorNode &>(*heapNode);
+    heapOperatorNode.rightHandSide = std::move(secondNode);
+    heapOperatorNode.rightHandSide->parent = &heapOperatorNode;
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*heapNode) ==
+            "3 + 1 + 2");
+    std::thread([&]() { heapNode.reset(); }).join();
+
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*firstNode) ==
+            gd::ExpressionParser2NodePrinter::PrintNode(
+                *gd::ExpressionParser2().ParseExpression(expression)));
+  }
+}
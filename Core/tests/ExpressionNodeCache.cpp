@@ -0,0 +1,150 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Events/Parsers/ExpressionNodeCache.h"
+
+#include <thread>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/Expression.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/WholeProjectRefactorer.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ExpressionNodeCache", "[common][events]") {
+  auto &cache = *gd::ExpressionNodeCache::Get();
+  cache.Clear();
+
+  SECTION("Share the tree of copied and identical expressions") {
+    gd::Expression expression("MyObject.X() + 1");
+    gd::ExpressionNode *node = expression.GetRootNode();
+    REQUIRE(node != nullptr);
+    REQUIRE(cache.GetMissesCount() == 1);
+
+    gd::Expression copiedExpression = expression;
+    REQUIRE(copiedExpression.GetRootNode() == node);
+    gd::Expression assignedExpression;
+    assignedExpression = expression;
+    REQUIRE(assignedExpression.GetRootNode() == node);
+    REQUIRE(cache.GetHitsCount() == 0);
+
+    gd::Expression identicalExpression("MyObject.X() + 1");
+    REQUIRE(identicalExpression.GetRootNode() == node);
+    REQUIRE(cache.GetHitsCount() == 1);
+
+    gd::Expression otherExpression("MyObject.Y() + 1");
+    REQUIRE(otherExpression.GetRootNode() != node);
+    REQUIRE(cache.GetHitsCount() == 1);
+    REQUIRE(cache.GetMissesCount() == 2);
+  }
+
+  SECTION("Parse an expression read from several threads") {
+    // Without cache, each thread parses its own tree but only one is kept.
+    std::size_t maximumSize = cache.GetMaximumSize();
+    cache.SetMaximumSize(0);
+
+    for (std::size_t attempt = 0; attempt < 20; ++attempt) {
+      gd::Expression expression("MyObject.X() + " +
+                                gd::String::From(attempt));
+      std::vector<gd::ExpressionNode *> nodes(4, nullptr);
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < nodes.size(); ++t) {
+        threads.emplace_back([&expression, &nodes, t]() {
+          nodes[t] = expression.GetRootNode();
+        });
+      }
+      for (auto &thread : threads) thread.join();
+
+      for (auto *node : nodes) REQUIRE(node == expression.GetRootNode());
+    }
+
+    cache.SetMaximumSize(maximumSize);
+  }
+
+  SECTION("Remove the least recently used trees") {
+    std::size_t maximumSize = cache.GetMaximumSize();
+    cache.SetMaximumSize(10);
+
+    gd::Expression firstExpression("1 + 2 + 3");
+    gd::Expression secondExpression("4 + 5");
+    firstExpression.GetRootNode();
+    secondExpression.GetRootNode();
+    REQUIRE(cache.GetSize() == 5);
+
+    // The tree is still used by the expression.
+    auto *operatorNode =
+        dynamic_cast<gd::OperatorNode *>(firstExpression.GetRootNode());
+    REQUIRE(operatorNode != nullptr);
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*operatorNode) ==
+            "1 + 2 + 3");
+
+    gd::Expression identicalExpression("1 + 2 + 3");
+    REQUIRE(identicalExpression.GetRootNode() != operatorNode);
+    REQUIRE(cache.GetMissesCount() == 3);
+
+    cache.SetMaximumSize(maximumSize);
+  }
+
+  SECTION("Modify a tree without changing the other expressions") {
+    gd::Expression expression("MyObject.X()");
+    auto node = expression.ParseModifiableRootNode();
+    REQUIRE(node.get() != expression.GetRootNode());
+
+    dynamic_cast<gd::FunctionCallNode &>(*node).objectName = "MyRenamedObject";
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            "MyRenamedObject.X()");
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(
+                *gd::Expression("MyObject.X()").GetRootNode()) ==
+            "MyObject.X()");
+  }
+
+  SECTION("Rename an object used by identical expressions") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+
+    gd::Instruction action;
+    action.SetType("MyExtension::DoSomething");
+    action.SetParametersCount(1);
+    action.SetParameter(0, gd::Expression("MyObject.GetObjectNumber() + 1"));
+    gd::StandardEvent event;
+    event.GetActions().Insert(action);
+    event.GetActions().Insert(action);
+    layout.GetEvents().InsertEvent(event);
+    layout.GetEvents().InsertEvent(event);
+
+    // Parse the expressions before renaming the object.
+    auto &events = layout.GetEvents();
+    for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+      auto &actions =
+          dynamic_cast<gd::StandardEvent &>(events.GetEvent(i)).GetActions();
+      for (std::size_t j = 0; j < actions.size(); ++j) {
+        REQUIRE(actions[j].GetParameter(0).GetRootNode() != nullptr);
+      }
+    }
+
+    gd::WholeProjectRefactorer::ObjectOrGroupRenamedInLayout(
+        project, layout, "MyObject", "MyRenamedObject",
+        /* isObjectGroup =*/false);
+
+    for (std::size_t i = 0; i < events.GetEventsCount(); ++i) {
+      auto &actions =
+          dynamic_cast<gd::StandardEvent &>(events.GetEvent(i)).GetActions();
+      for (std::size_t j = 0; j < actions.size(); ++j) {
+        REQUIRE(actions[j].GetParameter(0).GetPlainString() ==
+                "MyRenamedObject.GetObjectNumber() + 1");
+      }
+    }
+  }
+}
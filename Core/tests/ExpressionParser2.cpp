@@ -3469,6 +3469,24 @@ TEST_CASE("ExpressionParser2", "[common][events]") {
         REQUIRE(operatorNode.rightHandSide->location.GetStartPosition() == 7);
         REQUIRE(operatorNode.rightHandSide->location.GetEndPosition() == 10);
       }
+      {
+        // Locations are expressed in characters, not in bytes.
+        auto node = parser.ParseExpression("\"héllo 世界\" + MyVàriable");
+        REQUIRE(node != nullptr);
+        auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+        REQUIRE(operatorNode.location.GetStartPosition() == 0);
+        REQUIRE(operatorNode.location.GetEndPosition() == 23);
+        auto &textNode =
+            dynamic_cast<gd::TextNode &>(*operatorNode.leftHandSide);
+        REQUIRE(textNode.text == "héllo 世界");
+        REQUIRE(textNode.location.GetStartPosition() == 0);
+        REQUIRE(textNode.location.GetEndPosition() == 10);
+        auto &identifierNode =
+            dynamic_cast<gd::IdentifierNode &>(*operatorNode.rightHandSide);
+        REQUIRE(identifierNode.identifierName == "MyVàriable");
+        REQUIRE(identifierNode.identifierNameLocation.GetStartPosition() == 13);
+        REQUIRE(identifierNode.identifierNameLocation.GetEndPosition() == 23);
+      }
     }
     SECTION("Variable locations (simple variable name)") {
       auto node = parser.ParseExpression("MyVariable");
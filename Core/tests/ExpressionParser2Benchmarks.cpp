@@ -7,6 +7,7 @@
 #include <numeric>
 #include "DummyPlatform.h"
 #include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
 #include "GDCore/Extensions/Platform.h"
 #include "GDCore/Extensions/PlatformExtension.h"
 #include "GDCore/IDE/Events/ExpressionValidator.h"
@@ -124,4 +125,92 @@ TEST_CASE("ExpressionParser2 - Benchmarks", "[common][events]") {
           "AndAgainAndAgainAndAgainAndAgainAndAgainAndAgainAndAgain"));
     });
   }
+
+  SECTION("Parse short, medium and very long expressions") {
+    auto makeConcatenation = [](size_t termsCount) {
+      gd::String expression = "\"Start\"";
+      for (size_t i = 0; i < termsCount; i++) {
+        expression += " + ToString(MySpriteObject.X()) + "
+                      "\"Some text, \\\"quoted\\\"\"";
+      }
+      return expression;
+    };
+    const gd::String shortExpression = makeConcatenation(1);
+    const gd::String mediumExpression = makeConcatenation(50);
+    const gd::String veryLongExpression = makeConcatenation(2000);
+
+    doBenchmark("Parse short expression", 1000, [&]() {
+      REQUIRE(parser.ParseExpression(shortExpression) != nullptr);
+    });
+    doBenchmark("Parse medium expression", 100, [&]() {
+      REQUIRE(parser.ParseExpression(mediumExpression) != nullptr);
+    });
+    doBenchmark("Parse very long expression", 10, [&]() {
+      REQUIRE(parser.ParseExpression(veryLongExpression) != nullptr);
+    });
+
+    // Replace "X" by "Y" in the middle of the expression, then back.
+    size_t editPosition =
+        veryLongExpression.find("X()", veryLongExpression.size() / 2);
+    gd::String editedExpression = veryLongExpression;
+    editedExpression.replace(editPosition, 1, "Y");
+    auto node = parser.ParseExpression(veryLongExpression);
+    doBenchmark("Parse edited very long expression (whole expression)", 10,
+                [&]() {
+                  node = parser.ParseExpression(editedExpression);
+                  node = parser.ParseExpression(veryLongExpression);
+                });
+    doBenchmark("Parse edited very long expression (edited parameter)", 10,
+                [&]() {
+                  node = parser.ParseEditedExpression(
+                      editedExpression, std::move(node), editPosition,
+                      editPosition + 1, editPosition + 1);
+                  node = parser.ParseEditedExpression(
+                      veryLongExpression, std::move(node), editPosition,
+                      editPosition + 1, editPosition + 1);
+                });
+    REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(*node) ==
+            gd::ExpressionParser2NodePrinter::PrintNode(
+                *parser.ParseExpression(veryLongExpression)));
+  }
+
+  SECTION("Parse expressions with nodes allocated from an arena") {
+    const std::vector<gd::String> expressions = {
+        "1",
+        "3.14159",
+        "\"hello world\"",
+        "345 +  678",
+        "-(2 + 3) * 4 / 5",
+        "MySpriteObject.X()",
+        "MySpriteObject.X() + MySpriteObject.Y() * 2",
+        "MySpriteObject.MyBehavior::GetBehaviorNumber()",
+        "MyExtension::GetNumberWith2Params(12, \"hello world\")",
+        "MySceneVariable.MyChild[\"Hello\" + MySceneStringVariable].Child",
+        "ToString(MySpriteObject.X()) + \"Some text\" + MySceneStringVariable",
+        "abs(MySpriteObject.Variable(MyVariable) - 1) + cos(3.123456789)",
+    };
+    const size_t treesCount = 10000;
+
+    std::vector<std::unique_ptr<gd::ExpressionNode>> trees;
+    trees.reserve(treesCount);
+    auto parseAll = [&](gd::ExpressionParser2 &parser) {
+      for (size_t i = 0; i < treesCount; i++) {
+        trees.push_back(
+            parser.ParseExpression(expressions[i % expressions.size()]));
+      }
+      trees.clear();
+    };
+
+    doBenchmark("Parse expressions (each node allocated separately)", 5,
+                [&]() {
+                  gd::ExpressionParser2 heapParser;
+                  parseAll(heapParser);
+                });
+    doBenchmark("Parse expressions (an arena for all expressions)", 5, [&]() {
+      gd::ExpressionParser2 arenaParser;
+      arenaParser.UseArenaAllocation(
+          std::make_shared<gd::ExpressionNodeArena>());
+      parseAll(arenaParser);
+    });
+  }
 }
@@ -0,0 +1,145 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <typeinfo>
+
+#include "GDCore/Events/Parsers/ExpressionParser2.h"
+#include "GDCore/Events/Parsers/ExpressionParser2Node.h"
+#include "GDCore/Events/Parsers/ExpressionParser2NodePrinter.h"
+#include "GDCore/IDE/Events/ExpressionNodeLocationFinder.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * Check that the tree of an edited expression is the same as the tree
+ * obtained by parsing the whole expression again.
+ */
+void RequireSameTree(gd::ExpressionNode &editedNode,
+                     gd::ExpressionNode &parsedNode,
+                     const gd::String &expression) {
+  REQUIRE(gd::ExpressionParser2NodePrinter::PrintNode(editedNode) ==
+          gd::ExpressionParser2NodePrinter::PrintNode(parsedNode));
+
+  for (size_t position = 0; position <= expression.size(); position++) {
+    auto *editedNodeAtPosition =
+        gd::ExpressionNodeLocationFinder::GetNodeAtPosition(editedNode,
+                                                            position);
+    auto *parsedNodeAtPosition =
+        gd::ExpressionNodeLocationFinder::GetNodeAtPosition(parsedNode,
+                                                            position);
+    REQUIRE((editedNodeAtPosition == nullptr) ==
+            (parsedNodeAtPosition == nullptr));
+    if (!editedNodeAtPosition) continue;
+
+    REQUIRE(typeid(*editedNodeAtPosition) == typeid(*parsedNodeAtPosition));
+    REQUIRE(editedNodeAtPosition->location.GetStartPosition() ==
+            parsedNodeAtPosition->location.GetStartPosition());
+    REQUIRE(editedNodeAtPosition->location.GetEndPosition() ==
+            parsedNodeAtPosition->location.GetEndPosition());
+
+    auto *editedDiagnostic = editedNodeAtPosition->diagnostic.get();
+    auto *parsedDiagnostic = parsedNodeAtPosition->diagnostic.get();
+    REQUIRE((editedDiagnostic == nullptr) == (parsedDiagnostic == nullptr));
+    if (!editedDiagnostic) continue;
+
+    REQUIRE(editedDiagnostic->IsError() == parsedDiagnostic->IsError());
+    REQUIRE(editedDiagnostic->GetMessage() == parsedDiagnostic->GetMessage());
+    REQUIRE(editedDiagnostic->GetStartPosition() ==
+            parsedDiagnostic->GetStartPosition());
+    REQUIRE(editedDiagnostic->GetEndPosition() ==
+            parsedDiagnostic->GetEndPosition());
+  }
+}
+}  // namespace
+
+TEST_CASE("ExpressionParser2 - Edited expressions", "[common][events]") {
+  gd::ExpressionParser2 parser;
+
+  SECTION("Parse again only an edited parameter") {
+    gd::String expression =
+        "MyExtension::GetNumberWith2Params(12, \"hello world\") + "
+        "MyObject.X()";
+    auto node = parser.ParseExpression(expression);
+    auto *rootNode = node.get();
+    auto &operatorNode = dynamic_cast<gd::OperatorNode &>(*node);
+    auto &functionNode =
+        dynamic_cast<gd::FunctionCallNode &>(*operatorNode.leftHandSide);
+    auto *textNode = functionNode.parameters[1].get();
+    auto *objectFunctionNode = operatorNode.rightHandSide.get();
+
+    // Insert "3" after "12".
+    gd::String editedExpression =
+        "MyExtension::GetNumberWith2Params(123, \"hello world\") + "
+        "MyObject.X()";
+    node = parser.ParseEditedExpression(editedExpression, std::move(node), 36,
+                                        36, 37);
+
+    REQUIRE(node.get() == rootNode);
+    REQUIRE(functionNode.parameters[1].get() == textNode);
+    REQUIRE(operatorNode.rightHandSide.get() == objectFunctionNode);
+    REQUIRE(functionNode.parameters[0]->parent == &functionNode);
+    REQUIRE(dynamic_cast<gd::NumberNode &>(*functionNode.parameters[0])
+                .number == "123");
+    REQUIRE(textNode->location.GetStartPosition() == 39);
+    REQUIRE(functionNode.closingParenthesisLocation.GetStartPosition() == 52);
+    RequireSameTree(*node, *parser.ParseExpression(editedExpression),
+                    editedExpression);
+  }
+
+  SECTION("Parse again the whole expression if needed") {
+    gd::String expression = "MyExtension::GetNumberWith2Params(12, 3) + 4";
+    auto node = parser.ParseExpression(expression);
+
+    // Remove "2, 3".
+    gd::String editedExpression = "MyExtension::GetNumberWith2Params(1) + 4";
+    node = parser.ParseEditedExpression(editedExpression, std::move(node), 35,
+                                        39, 35);
+    RequireSameTree(*node, *parser.ParseExpression(editedExpression),
+                    editedExpression);
+  }
+
+  SECTION("Parse expressions edited anywhere") {
+    const std::vector<gd::String> expressions = {
+        "1 + 2",
+        "-(2 + 3) * 4 / 5",
+        "\"hello\" + \"world\"",
+        "MyObject.X() + MyObject.MyBehavior::GetSomething(1, 2) * 3",
+        "MyExtension::GetNumberWith2Params(12, \"hello, world\")",
+        "MyExtension::GetNumberWith2Params(, (1 + 2)",
+        "MyVariable.MyChild[\"Hello\" + MyOtherVariable[1 + 2]].Child",
+        "abs(MyObject.Variable(MyVariable) - 1) + cos(3.14 ) )",
+        "MyFunction(1 + (2 * (3 - 4)), [5, 6], \"text\"",
+    };
+    const std::vector<gd::String> insertedTexts = {
+        "1", "a", " ", ",", "(", ")", "[", "]", "\"", "+", "*", ".", ":", "-"};
+
+    for (const auto &expression : expressions) {
+      for (size_t position = 0; position <= expression.size(); position++) {
+        for (const auto &insertedText : insertedTexts) {
+          gd::String editedExpression = expression.substr(0, position) +
+                                        insertedText +
+                                        expression.substr(position);
+          INFO("Edited expression: " << editedExpression);
+          auto node = parser.ParseEditedExpression(
+              editedExpression, parser.ParseExpression(expression), position,
+              position, position + 1);
+          RequireSameTree(*node, *parser.ParseExpression(editedExpression),
+                          editedExpression);
+        }
+
+        if (position < expression.size()) {
+          gd::String editedExpression = expression.substr(0, position) +
+                                        expression.substr(position + 1);
+          INFO("Edited expression: " << editedExpression);
+          auto node = parser.ParseEditedExpression(
+              editedExpression, parser.ParseExpression(expression), position,
+              position + 1, position);
+          RequireSameTree(*node, *parser.ParseExpression(editedExpression),
+                          editedExpression);
+        }
+      }
+    }
+  }
+}
@@ -219,6 +219,21 @@ TEST_CASE("InitialInstancesContainer", "[common][instances]") {
                           MakeInstance("object3", "layer2", 9)}) == true);
   }
 
+  SECTION("HasInstancesOfObject") {
+    REQUIRE(container.HasInstancesOfObject("object1") == true);
+    REQUIRE(container.HasInstancesOfObject("object4") == false);
+    REQUIRE(container.HasInstancesOfObject("NeverUsedObjectName") == false);
+
+    container.RenameInstancesOfObject("NeverUsedObjectName", "object4");
+    container.RemoveInitialInstancesOfObject("NeverUsedObjectName");
+    REQUIRE(container.GetInstancesCount() == 7);
+    REQUIRE(container.HasInstancesOfObject("object4") == false);
+
+    container.RenameInstancesOfObject("object3", "object4");
+    REQUIRE(container.HasInstancesOfObject("object3") == false);
+    REQUIRE(container.HasInstancesOfObject("object4") == true);
+  }
+
   SECTION("SomeInstancesAreOnLayer") {
     REQUIRE(container.SomeInstancesAreOnLayer("layer1") == true);
     REQUIRE(container.SomeInstancesAreOnLayer("layer2") == true);
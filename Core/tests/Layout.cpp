@@ -19,6 +19,69 @@ using namespace gd;
 
 TEST_CASE("Layout", "[common]") {
 
+  SECTION("Find objects by their names in a large list") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Layout &layout = project.InsertNewLayout("Scene", 0);
+    for (std::size_t i = 0; i < 100; ++i) {
+      layout.InsertNewObject(project, "MyExtension::Sprite",
+                             "MyObject" + gd::String::From(i),
+                             layout.GetObjectsCount());
+    }
+    REQUIRE(layout.HasObjectNamed("MyObject42"));
+    REQUIRE(layout.GetObjectPosition("MyObject42") == 42);
+    REQUIRE(!layout.HasObjectNamed("MyObject100"));
+
+    // Inserting, moving and removing objects updates the positions.
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyNewObject", 0);
+    REQUIRE(layout.GetObjectPosition("MyNewObject") == 0);
+    REQUIRE(layout.GetObjectPosition("MyObject42") == 43);
+    layout.MoveObject(0, 100);
+    REQUIRE(layout.GetObjectPosition("MyNewObject") == 100);
+    REQUIRE(layout.GetObjectPosition("MyObject42") == 42);
+    layout.RemoveObject("MyObject0");
+    REQUIRE(!layout.HasObjectNamed("MyObject0"));
+    REQUIRE(layout.GetObjectPosition("MyObject42") == 41);
+
+    // Renaming an object is taken into account.
+    layout.GetObject("MyObject42").SetName("MyRenamedObject");
+    REQUIRE(!layout.HasObjectNamed("MyObject42"));
+    REQUIRE(layout.GetObjectPosition("MyRenamedObject") == 41);
+    REQUIRE(&layout.GetObject("MyRenamedObject") == &layout.GetObject(41));
+
+    // Copies have their own objects.
+    gd::Layout copiedLayout = layout;
+    copiedLayout.RemoveObject("MyRenamedObject");
+    REQUIRE(!copiedLayout.HasObjectNamed("MyRenamedObject"));
+    REQUIRE(layout.HasObjectNamed("MyRenamedObject"));
+    REQUIRE(&copiedLayout.GetObject("MyObject99") !=
+            &layout.GetObject("MyObject99"));
+  }
+
+  SECTION("Find layouts by their names in a large list") {
+    gd::Project project;
+    for (std::size_t i = 0; i < 100; ++i) {
+      project.InsertNewLayout("Scene" + gd::String::From(i),
+                              project.GetLayoutsCount());
+    }
+    REQUIRE(project.HasLayoutNamed("Scene42"));
+    REQUIRE(project.GetLayoutPosition("Scene42") == 42);
+    REQUIRE(project.GetLayout("Scene42").GetName() == "Scene42");
+
+    project.SwapLayouts(0, 42);
+    REQUIRE(project.GetLayoutPosition("Scene42") == 0);
+    REQUIRE(project.GetLayoutPosition("Scene0") == 42);
+    project.RemoveLayout("Scene42");
+    REQUIRE(!project.HasLayoutNamed("Scene42"));
+    REQUIRE(project.GetLayoutPosition("Scene0") == 41);
+
+    project.GetLayout("Scene0").SetName("MyRenamedScene");
+    REQUIRE(!project.HasLayoutNamed("Scene0"));
+    REQUIRE(project.GetLayoutPosition("MyRenamedScene") == 41);
+  }
+
   SECTION("Find the type of a behavior in a object") {
     gd::Platform platform;
     gd::Project project;
@@ -0,0 +1,131 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+
+#include <memory>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/BehaviorMetadata.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+std::shared_ptr<gd::PlatformExtension> MakeExtension(
+    const gd::String &name, const gd::String &actionFullName) {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(name, name, "", "", "");
+  extension->AddAction("DoSomething", actionFullName, "", "", "", "", "");
+  return extension;
+}
+}  // namespace
+
+TEST_CASE("MetadataProvider", "[common]") {
+  SECTION("Find metadata declared by extensions") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyExtension::DoSomething")
+                .GetFullName() == "Do something");
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyExtension::SetAnimationName")
+                .GetFullName() == "Change the animation (by name)");
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "MyExtension::BehaviorDoSomething")
+                .GetFullName() == "Do something on behavior");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetConditionMetadata(
+            platform, "MyExtension::DoSomething")));
+    REQUIRE(!gd::MetadataProvider::IsBadObjectMetadata(
+        gd::MetadataProvider::GetObjectMetadata(platform,
+                                                "MyExtension::Sprite")));
+    REQUIRE(!gd::MetadataProvider::IsBadBehaviorMetadata(
+        gd::MetadataProvider::GetBehaviorMetadata(
+            platform, "MyExtension::MyBehavior")));
+    REQUIRE(gd::MetadataProvider::GetExtensionAndBehaviorMetadata(
+                platform, "MyExtension::MyBehavior")
+                .GetExtension()
+                .GetName() == "MyExtension");
+
+    // Object expressions fall back to the expressions of the base object.
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetObjectNumber")));
+    REQUIRE(!gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "GetFromBaseExpression")));
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "", "GetObjectNumber")));
+    REQUIRE(gd::MetadataProvider::IsBadExpressionMetadata(
+        gd::MetadataProvider::GetObjectExpressionMetadata(
+            platform, "MyExtension::Sprite", "Unknown")));
+  }
+
+  SECTION("Find metadata of instructions from their symbols") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    gd::Instruction action("MyExtension::SetAnimationName");
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(platform,
+                                                    action.GetTypeSymbol())
+                .GetFullName() == "Change the animation (by name)");
+    REQUIRE(gd::MetadataProvider::GetExtensionAndActionMetadata(
+                platform, action.GetTypeSymbol())
+                .GetExtension()
+                .GetName() == "MyExtension");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetConditionMetadata(platform,
+                                                   action.GetTypeSymbol())));
+
+    gd::Instruction unknownAction("MyExtension::NeverDeclaredAction");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, unknownAction.GetTypeSymbol())));
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, "MyExtension::NeverInternedAction")));
+  }
+
+  SECTION("Extensions added or removed after metadata was searched") {
+    gd::Platform platform;
+    platform.AddExtension(MakeExtension("FirstExtension", "First"));
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "FirstExtension::DoSomething")
+                .GetFullName() == "First");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, "SecondExtension::DoSomething")));
+
+    platform.AddExtension(MakeExtension("SecondExtension", "Second"));
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "SecondExtension::DoSomething")
+                .GetFullName() == "Second");
+
+    // Replace an extension.
+    platform.AddExtension(MakeExtension("FirstExtension", "New first"));
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "FirstExtension::DoSomething")
+                .GetFullName() == "New first");
+
+    platform.RemoveExtension("FirstExtension");
+    REQUIRE(gd::MetadataProvider::IsBadInstructionMetadata(
+        gd::MetadataProvider::GetActionMetadata(
+            platform, "FirstExtension::DoSomething")));
+    REQUIRE(gd::MetadataProvider::GetActionMetadata(
+                platform, "SecondExtension::DoSomething")
+                .GetFullName() == "Second");
+  }
+}
@@ -0,0 +1,162 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <memory>
+#include <numeric>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerationContext.h"
+#include "GDCore/Events/CodeGeneration/EventsCodeGenerator.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Metadata/ExpressionMetadata.h"
+#include "GDCore/Extensions/Metadata/InstructionMetadata.h"
+#include "GDCore/Extensions/Metadata/MetadataProvider.h"
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+namespace {
+void AddManyExtensions(gd::Platform &platform) {
+  // Have as many extensions as a real platform, declared before the ones
+  // used by the events.
+  for (std::size_t i = 0; i < 40; ++i) {
+    gd::String extensionName = "FillerExtension" + gd::String::From(i);
+    auto extension = std::make_shared<gd::PlatformExtension>();
+    extension->SetExtensionInformation(extensionName, "Filler", "", "", "");
+    for (std::size_t j = 0; j < 20; ++j) {
+      gd::String name = "Instruction" + gd::String::From(j);
+      extension->AddAction(name, "", "", "", "", "", "");
+      extension->AddCondition(name, "", "", "", "", "", "");
+      extension->AddExpression(name, "", "", "", "");
+    }
+    for (std::size_t j = 0; j < 5; ++j) {
+      gd::String objectName = "Object" + gd::String::From(j);
+      auto &object = extension->AddObject(
+          objectName, "", "", "", std::make_shared<gd::ObjectConfiguration>());
+      for (std::size_t k = 0; k < 20; ++k) {
+        gd::String name = objectName + "Instruction" + gd::String::From(k);
+        object.AddAction(name, "", "", "", "", "", "");
+        object.AddCondition(name, "", "", "", "", "", "");
+        object.AddExpression(name, "", "", "", "");
+      }
+    }
+    platform.AddExtension(extension);
+  }
+}
+}  // namespace
+
+TEST_CASE("MetadataProvider - Benchmarks", "[common]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  gd::Platform platform;
+  AddManyExtensions(platform);
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  auto &layout = project.InsertNewLayout("Scene", 0);
+  layout.InsertNewObject(
+      project, "MyExtension::Sprite", "MySpriteObject", 0);
+
+  SECTION("Find metadata") {
+    doBenchmark("Find actions and expressions metadata", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (std::size_t i = 0; i < 10000; ++i) {
+        if (!gd::MetadataProvider::IsBadInstructionMetadata(
+                gd::MetadataProvider::GetActionMetadata(
+                    platform, "MyExtension::DoSomething")))
+          foundCount++;
+        if (!gd::MetadataProvider::IsBadExpressionMetadata(
+                gd::MetadataProvider::GetObjectExpressionMetadata(
+                    platform, "MyExtension::Sprite", "GetObjectNumber")))
+          foundCount++;
+      }
+      REQUIRE(foundCount == 20000);
+    });
+
+    gd::Instruction action("FillerExtension39::Object4Instruction19");
+    doBenchmark("Find actions metadata from their types", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (std::size_t i = 0; i < 100000; ++i) {
+        if (!gd::MetadataProvider::IsBadInstructionMetadata(
+                gd::MetadataProvider::GetActionMetadata(platform,
+                                                        action.GetType())))
+          foundCount++;
+      }
+      REQUIRE(foundCount == 100000);
+    });
+    doBenchmark("Find actions metadata from their types symbols", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (std::size_t i = 0; i < 100000; ++i) {
+        if (!gd::MetadataProvider::IsBadInstructionMetadata(
+                gd::MetadataProvider::GetActionMetadata(
+                    platform, action.GetTypeSymbol())))
+          foundCount++;
+      }
+      REQUIRE(foundCount == 100000);
+    });
+  }
+
+  SECTION("Generate code for a large events sheet") {
+    std::vector<gd::StandardEvent> events;
+    for (std::size_t i = 0; i < 1000; ++i) {
+      gd::StandardEvent event;
+      gd::Instruction condition("FillerExtension39::Instruction0");
+      event.GetConditions().Insert(condition);
+
+      gd::Instruction action("MyExtension::DoSomething");
+      action.SetParametersCount(1);
+      action.SetParameter(
+          0, "MyExtension::GetNumber() + MySpriteObject.GetObjectNumber()");
+      event.GetActions().Insert(action);
+
+      gd::Instruction objectAction("MyExtension::SetAnimationName");
+      objectAction.SetParametersCount(2);
+      objectAction.SetParameter(0, "MySpriteObject");
+      objectAction.SetParameter(1, "\"Walk\"");
+      event.GetActions().Insert(objectAction);
+      events.push_back(event);
+    }
+
+    doBenchmark("Generate code for 1000 events", 3, [&]() {
+      gd::EventsCodeGenerator codeGenerator(project, layout, platform);
+      gd::String code;
+      for (std::size_t i = 0; i < events.size(); ++i) {
+        gd::EventsCodeGenerationContext context;
+        code += codeGenerator.GenerateConditionsListCode(
+            events[i].GetConditions(), context);
+        code += codeGenerator.GenerateActionsListCode(
+            events[i].GetActions(), context);
+      }
+      REQUIRE(code.find("doSomething") != gd::String::npos);
+      REQUIRE(!codeGenerator.ErrorOccurred());
+    });
+  }
+}
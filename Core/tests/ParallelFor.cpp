@@ -0,0 +1,57 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/ParallelFor.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "catch.hpp"
+
+TEST_CASE("ParallelFor", "[common]") {
+  SECTION("Call the function once for each index") {
+    std::vector<std::atomic<int>> callsCount(1000);
+    for (auto &count : callsCount) count = 0;
+
+    gd::ParallelFor(callsCount.size(),
+                    [&](std::size_t i) { callsCount[i]++; });
+    for (const auto &count : callsCount) REQUIRE(count == 1);
+
+    gd::ParallelFor(0, [&](std::size_t i) { FAIL("No index to process"); });
+  }
+
+  SECTION("Find objects and layouts from several threads") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    std::vector<gd::String> names;
+    for (std::size_t i = 0; i < 200; ++i) {
+      names.push_back("MyName" + gd::String::From(i));
+      project.InsertNewObject(
+          project, "MyExtension::Sprite", names.back(), i);
+      project.InsertNewLayout(names.back(), i);
+    }
+
+    // The indices are built by the first thread doing a lookup.
+    std::atomic<std::size_t> foundCount(0);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 4; ++t) {
+      threads.emplace_back([&]() {
+        for (const gd::String &name : names) {
+          if (project.HasObjectNamed(name)) foundCount++;
+          if (project.GetLayoutPosition(name) != gd::String::npos)
+            foundCount++;
+        }
+      });
+    }
+    for (auto &thread : threads) thread.join();
+    REQUIRE(foundCount == 4 * 2 * names.size());
+  }
+}
@@ -0,0 +1,75 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Extensions/Platform.h"
+
+#include <memory>
+
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "catch.hpp"
+
+namespace {
+std::shared_ptr<gd::PlatformExtension> MakeExtension(
+    const gd::String &name, const gd::String &fullName = "") {
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(name, fullName, "", "", "");
+  extension->AddObject(
+      "Object", "", "", "", std::make_shared<gd::ObjectConfiguration>());
+  return extension;
+}
+}  // namespace
+
+TEST_CASE("Platform", "[common]") {
+  SECTION("Declare the lazily added extensions on first use, in order") {
+    gd::Platform platform;
+    std::size_t declaredCount = 0;
+    platform.AddLazilyDeclaredExtension([&declaredCount]() {
+      declaredCount++;
+      return MakeExtension("First");
+    });
+    platform.AddExtension(MakeExtension("Second"));
+    platform.AddLazilyDeclaredExtension([&declaredCount]() {
+      declaredCount++;
+      return MakeExtension("Third");
+    });
+    REQUIRE(declaredCount == 0);
+
+    auto &extensions = platform.GetAllPlatformExtensions();
+    REQUIRE(declaredCount == 2);
+    REQUIRE(extensions.size() == 3);
+    REQUIRE(extensions[0]->GetName() == "First");
+    REQUIRE(extensions[1]->GetName() == "Second");
+    REQUIRE(extensions[2]->GetName() == "Third");
+
+    auto object = platform.CreateObjectConfiguration("Third::Object");
+    REQUIRE(object->GetType() == "Third::Object");
+    REQUIRE(declaredCount == 2);
+  }
+
+  SECTION("Create objects from lazily declared extensions") {
+    gd::Platform platform;
+    platform.AddLazilyDeclaredExtension([]() { return MakeExtension("A"); });
+
+    auto object = platform.CreateObjectConfiguration("A::Object");
+    REQUIRE(object->GetType() == "A::Object");
+    REQUIRE(platform.IsExtensionLoaded("A"));
+  }
+
+  SECTION("Replace an extension by a lazily declared one") {
+    gd::Platform platform;
+    platform.AddExtension(MakeExtension("A", "Initial"));
+    platform.AddLazilyDeclaredExtension(
+        []() { return MakeExtension("A", "Replaced"); });
+
+    REQUIRE(platform.GetAllPlatformExtensions().size() == 1);
+    REQUIRE(platform.GetExtension("A")->GetFullName() == "Replaced");
+
+    platform.AddLazilyDeclaredExtension([]() { return MakeExtension("B"); });
+    platform.RemoveExtension("B");
+    REQUIRE(platform.GetAllPlatformExtensions().size() == 1);
+  }
+}
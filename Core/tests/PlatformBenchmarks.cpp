@@ -0,0 +1,170 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "GDCore/Extensions/Metadata/ObjectMetadata.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Extensions/PlatformExtension.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/ObjectConfiguration.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+const std::size_t extensionsCount = 40;
+
+std::shared_ptr<gd::PlatformExtension> DeclareFillerExtension(std::size_t i) {
+  gd::String extensionName = "FillerExtension" + gd::String::From(i);
+  auto extension = std::make_shared<gd::PlatformExtension>();
+  extension->SetExtensionInformation(extensionName, "Filler", "", "", "");
+  for (std::size_t j = 0; j < 20; ++j) {
+    gd::String name = "Instruction" + gd::String::From(j);
+    extension->AddAction(name, "", "", "", "", "", "")
+        .AddParameter("expression", "")
+        .AddParameter("string", "");
+    extension->AddCondition(name, "", "", "", "", "", "")
+        .AddParameter("expression", "");
+    extension->AddExpression(name, "", "", "", "")
+        .AddParameter("expression", "");
+  }
+  for (std::size_t j = 0; j < 5; ++j) {
+    gd::String objectName = "Object" + gd::String::From(j);
+    auto &object = extension->AddObject(
+        objectName, "", "", "", std::make_shared<gd::ObjectConfiguration>());
+    for (std::size_t k = 0; k < 20; ++k) {
+      gd::String name = objectName + "Instruction" + gd::String::From(k);
+      object.AddAction(name, "", "", "", "", "", "")
+          .AddParameter("object", "")
+          .AddParameter("expression", "");
+      object.AddCondition(name, "", "", "", "", "", "")
+          .AddParameter("object", "");
+      object.AddExpression(name, "", "", "", "").AddParameter("object", "");
+    }
+  }
+  return extension;
+}
+
+void AddFillerExtensions(gd::Platform &platform) {
+  platform.EnableExtensionLoadingLogs(false);
+  for (std::size_t i = 0; i < extensionsCount; ++i)
+    platform.AddExtension(DeclareFillerExtension(i));
+}
+
+void AddLazilyDeclaredFillerExtensions(gd::Platform &platform) {
+  platform.EnableExtensionLoadingLogs(false);
+  for (std::size_t i = 0; i < extensionsCount; ++i)
+    platform.AddLazilyDeclaredExtension(
+        [i]() { return DeclareFillerExtension(i); });
+}
+
+/**
+ * Return the resident memory of the process, in kilobytes (or 0 if it's not
+ * known on this system).
+ */
+std::size_t GetResidentMemoryInKilobytes() {
+#if defined(LINUX)
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 6, "VmRSS:") == 0) return std::stoul(line.substr(6));
+  }
+#endif
+  return 0;
+}
+}  // namespace
+
+TEST_CASE("Platform - Benchmarks", "[common]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  SECTION("Create a platform") {
+    // Measure the memory first, before the allocator has freed memory to reuse.
+    std::size_t memoryBefore = GetResidentMemoryInKilobytes();
+    gd::Platform platform;
+    AddFillerExtensions(platform);
+    std::size_t memoryAfter = GetResidentMemoryInKilobytes();
+    if (memoryAfter != 0)
+      std::cout << "Resident memory of the declared platform: "
+                << (memoryAfter - memoryBefore) << " kilobytes" << std::endl;
+
+    doBenchmark("Create a platform declaring its extensions", 3, [&]() {
+      gd::Platform platform;
+      AddFillerExtensions(platform);
+      REQUIRE(platform.GetAllPlatformExtensions().size() == extensionsCount);
+    });
+    doBenchmark("Create a platform with lazily declared extensions", 3, [&]() {
+      gd::Platform platform;
+      AddLazilyDeclaredFillerExtensions(platform);
+    });
+  }
+
+  SECTION("Create a platform and load a project") {
+    gd::SerializerElement projectElement;
+    {
+      gd::Platform platform;
+      AddFillerExtensions(platform);
+      gd::Project project;
+      project.AddPlatform(platform);
+      auto &layout = project.InsertNewLayout("Scene", 0);
+      for (std::size_t i = 0; i < 500; ++i) {
+        layout.InsertNewObject(project,
+                               "FillerExtension" +
+                                   gd::String::From(i % extensionsCount) +
+                                   "::Object0",
+                               "MyObject" + gd::String::From(i),
+                               layout.GetObjectsCount());
+      }
+      project.SerializeTo(projectElement);
+    }
+
+    auto loadProject = [&projectElement](gd::Platform &platform) {
+      gd::Project project;
+      project.AddPlatform(platform);
+      project.UnserializeFrom(projectElement);
+      REQUIRE(project.GetLayout("Scene").GetObjectsCount() == 500);
+    };
+    doBenchmark("Create a platform declaring its extensions and load a project",
+                3,
+                [&]() {
+                  gd::Platform platform;
+                  AddFillerExtensions(platform);
+                  loadProject(platform);
+                });
+    doBenchmark(
+        "Create a platform with lazily declared extensions and load a project",
+        3,
+        [&]() {
+          gd::Platform platform;
+          AddLazilyDeclaredFillerExtensions(platform);
+          loadProject(platform);
+        });
+  }
+}
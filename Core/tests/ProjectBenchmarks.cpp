@@ -0,0 +1,137 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ResourcesManager.h"
+#include "GDCore/Project/VariablesContainer.h"
+#include "catch.hpp"
+
+TEST_CASE("Project - Benchmarks", "[common]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  const std::size_t itemsCount = 5000;
+  gd::Platform platform;
+  gd::Project project;
+  SetupProjectWithDummyPlatform(project, platform);
+  std::vector<gd::String> names;
+  for (std::size_t i = 0; i < itemsCount; ++i) {
+    names.push_back("MyName" + gd::String::From(i));
+    project.InsertNewObject(project,
+                            "MyExtension::Sprite",
+                            names.back(),
+                            project.GetObjectsCount());
+    project.GetResourcesManager().AddResource(
+        names.back(), "resource.png", "image");
+    project.GetVariables().InsertNew(names.back(),
+                                     project.GetVariables().Count());
+  }
+  for (std::size_t i = 0; i < 500; ++i) {
+    project.InsertNewLayout(names[i], project.GetLayoutsCount());
+  }
+
+  SECTION("Find objects by their names") {
+    doBenchmark("Find objects (linear search)", 3, [&]() {
+      const auto &objects = project.GetObjects();
+      std::size_t foundCount = 0;
+      for (const gd::String &name : names) {
+        auto it = std::find_if(objects.begin(),
+                               objects.end(),
+                               [&](const std::unique_ptr<gd::Object> &object) {
+                                 return object->GetName() == name;
+                               });
+        if (it != objects.end()) foundCount++;
+      }
+      REQUIRE(foundCount == itemsCount);
+    });
+    doBenchmark("Find objects (index)", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (const gd::String &name : names) {
+        if (project.HasObjectNamed(name)) foundCount++;
+      }
+      REQUIRE(foundCount == itemsCount);
+    });
+  }
+
+  SECTION("Find resources by their names") {
+    const auto &resourcesManager = project.GetResourcesManager();
+    doBenchmark("Find resources (linear search)", 3, [&]() {
+      const auto &resources = resourcesManager.GetAllResources();
+      std::size_t foundCount = 0;
+      for (const gd::String &name : names) {
+        auto it = std::find_if(
+            resources.begin(),
+            resources.end(),
+            [&](const std::shared_ptr<gd::Resource> &resource) {
+              return resource->GetName() == name;
+            });
+        if (it != resources.end()) foundCount++;
+      }
+      REQUIRE(foundCount == itemsCount);
+    });
+    doBenchmark("Find resources (index)", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (const gd::String &name : names) {
+        if (resourcesManager.HasResource(name)) foundCount++;
+      }
+      REQUIRE(foundCount == itemsCount);
+    });
+  }
+
+  SECTION("Find variables and layouts by their names") {
+    doBenchmark("Find variables (index)", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (const gd::String &name : names) {
+        if (project.GetVariables().Has(name)) foundCount++;
+      }
+      REQUIRE(foundCount == itemsCount);
+    });
+    doBenchmark("Find layouts (index)", 3, [&]() {
+      std::size_t foundCount = 0;
+      for (std::size_t i = 0; i < 500; ++i) {
+        if (project.HasLayoutNamed(names[i])) foundCount++;
+      }
+      REQUIRE(foundCount == 500);
+    });
+  }
+
+  SECTION("Rename objects while finding them") {
+    doBenchmark("Rename and find objects", 3, [&]() {
+      for (std::size_t i = 0; i < 100; ++i) {
+        project.GetObject(names[i]).SetName("Renamed" + names[i]);
+        REQUIRE(project.HasObjectNamed("Renamed" + names[i]));
+        project.GetObject("Renamed" + names[i]).SetName(names[i]);
+      }
+    });
+  }
+}
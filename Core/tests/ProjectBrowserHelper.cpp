@@ -0,0 +1,150 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectBrowserHelper.h"
+
+#include <memory>
+#include <vector>
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Events/EventsList.h"
+#include "GDCore/Events/Instruction.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/IDE/Events/ArbitraryEventsWorker.h"
+#include "GDCore/Project/EventsBasedBehavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Project/ProjectScopedContainers.h"
+#include "catch.hpp"
+
+namespace {
+/**
+ * List the visited instructions and the objects of their context.
+ */
+class InstructionsLister : public gd::ArbitraryEventsWorkerWithContext {
+ public:
+  std::vector<gd::String> instructions;
+
+ private:
+  bool DoVisitInstruction(gd::Instruction &instruction,
+                          bool isCondition) override {
+    instructions.push_back(instruction.GetType());
+    if (GetObjectsContainersList().HasObjectOrGroupNamed("MyObject"))
+      instructions.back() += " with MyObject";
+    return false;
+  }
+};
+
+/**
+ * List the visited instructions, without modifying the events.
+ */
+class ReadOnlyInstructionsLister
+    : public gd::ReadOnlyArbitraryEventsWorkerWithContext {
+ public:
+  std::vector<gd::String> instructions;
+
+ private:
+  void DoVisitInstruction(const gd::Instruction &instruction,
+                          bool isCondition) override {
+    instructions.push_back(instruction.GetType());
+  }
+};
+
+void InsertAction(gd::EventsList &events, const gd::String &type) {
+  gd::StandardEvent event;
+  gd::Instruction action;
+  action.SetType(type);
+  event.GetActions().Insert(action);
+  events.InsertEvent(event);
+}
+
+void SetupProjectWithEvents(gd::Project &project) {
+  for (std::size_t i = 0; i < 10; ++i) {
+    auto &layout = project.InsertNewLayout("Scene" + gd::String::From(i), i);
+    layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    InsertAction(layout.GetEvents(), "Layout" + gd::String::From(i));
+  }
+
+  auto &externalEvents =
+      project.InsertNewExternalEvents("ExternalEvents", 0);
+  externalEvents.SetAssociatedLayout("Scene3");
+  InsertAction(externalEvents.GetEvents(), "ExternalEvents");
+  auto &unusedExternalEvents =
+      project.InsertNewExternalEvents("UnusedExternalEvents", 1);
+  InsertAction(unusedExternalEvents.GetEvents(), "UnusedExternalEvents");
+
+  auto &extension =
+      project.InsertNewEventsFunctionsExtension("MyEventsExtension", 0);
+  auto &function = extension.InsertNewEventsFunction("MyFunction", 0);
+  InsertAction(function.GetEvents(), "FreeFunction");
+  auto &behavior =
+      extension.GetEventsBasedBehaviors().InsertNew("MyBehavior", 0);
+  auto &behaviorFunction =
+      behavior.GetEventsFunctions().InsertNewEventsFunction("MyFunction", 0);
+  InsertAction(behaviorFunction.GetEvents(), "BehaviorFunction");
+  auto &object = extension.GetEventsBasedObjects().InsertNew("MyObject", 0);
+  auto &objectFunction =
+      object.GetEventsFunctions().InsertNewEventsFunction("MyFunction", 0);
+  InsertAction(objectFunction.GetEvents(), "ObjectFunction");
+}
+}  // namespace
+
+TEST_CASE("ProjectBrowserHelper", "[common]") {
+  SECTION("Expose the project events in parallel, in a deterministic order") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    SetupProjectWithEvents(project);
+
+    InstructionsLister sequentialLister;
+    gd::ProjectBrowserHelper::ExposeProjectEvents(project, sequentialLister);
+    REQUIRE(sequentialLister.instructions.size() == 14);
+
+    std::vector<gd::String> instructions;
+    gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+        project,
+        []() {
+          return std::unique_ptr<InstructionsLister>(new InstructionsLister());
+        },
+        [&instructions](InstructionsLister &lister) {
+          instructions.insert(instructions.end(), lister.instructions.begin(),
+                              lister.instructions.end());
+        });
+    REQUIRE(instructions == sequentialLister.instructions);
+  }
+
+  SECTION("Expose the project events in parallel to read-only workers") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    SetupProjectWithEvents(project);
+
+    std::vector<gd::String> instructions;
+    std::size_t workersCount = 0;
+    gd::ProjectBrowserHelper::ExposeProjectEventsInParallel(
+        project,
+        [&workersCount]() {
+          workersCount++;
+          return std::unique_ptr<ReadOnlyInstructionsLister>(
+              new ReadOnlyInstructionsLister());
+        },
+        [&instructions](ReadOnlyInstructionsLister &lister) {
+          instructions.insert(instructions.end(), lister.instructions.begin(),
+                              lister.instructions.end());
+        });
+    REQUIRE(workersCount == 14);
+    REQUIRE(instructions.size() == 14);
+    REQUIRE(instructions[0] == "Layout0");
+    REQUIRE(instructions[9] == "Layout9");
+    REQUIRE(instructions[10] == "ExternalEvents");
+    REQUIRE(instructions[11] == "FreeFunction");
+    REQUIRE(instructions[12] == "BehaviorFunction");
+    REQUIRE(instructions[13] == "ObjectFunction");
+  }
+}
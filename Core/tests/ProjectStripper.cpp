@@ -0,0 +1,99 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/IDE/ProjectStripper.h"
+
+#include "DummyPlatform.h"
+#include "GDCore/Events/Builtin/StandardEvent.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Behavior.h"
+#include "GDCore/Project/EventsBasedObject.h"
+#include "GDCore/Project/EventsFunctionsExtension.h"
+#include "GDCore/Project/ExternalEvents.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Object.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "catch.hpp"
+
+namespace {
+void RemoveObjectsFolderStructures(gd::SerializerElement &element) {
+  element.RemoveChild("objectsFolderStructure");
+  for (auto &child : element.GetAllChildren())
+    RemoveObjectsFolderStructures(*child.second);
+}
+}  // namespace
+
+TEST_CASE("ProjectStripper", "[common]") {
+  SECTION("Strip a serialized project like a stripped project") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+
+    auto &globalObject = project.InsertNewObject(
+        project, "MyExtension::Sprite", "MyGlobalObject", 0);
+    globalObject.AddNewBehavior(
+        project, "MyExtension::MyBehavior", "MyDefaultBehavior")
+        ->SetDefaultBehavior(true);
+    project.GetObjectGroups().InsertNew("MyGlobalGroup", 0);
+    project.InsertNewExternalEvents("MyExternalEvents", 0)
+        .GetEvents()
+        .InsertEvent(gd::StandardEvent());
+
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    auto &object =
+        layout.InsertNewObject(project, "MyExtension::Sprite", "MyObject", 0);
+    object.AddNewBehavior(project, "MyExtension::MyBehavior", "MyBehavior");
+    object.AddNewBehavior(
+        project, "MyExtension::MyBehavior", "MyDefaultBehavior")
+        ->SetDefaultBehavior(true);
+    layout.GetObjectGroups().InsertNew("MyGroup", 0);
+    layout.GetEvents().InsertEvent(gd::StandardEvent());
+
+    project.InsertNewEventsFunctionsExtension("MyFunctionsExtension", 0)
+        .InsertNewEventsFunction("MyFunction", 0);
+    auto &extension =
+        project.InsertNewEventsFunctionsExtension("MyObjectsExtension", 1);
+    extension.GetEventsBasedBehaviors().InsertNew("MyEventsBasedBehavior", 0);
+    auto &eventsBasedObject =
+        extension.GetEventsBasedObjects().InsertNew("MyEventsBasedObject", 0);
+    eventsBasedObject.SetFullName("My object");
+    eventsBasedObject.GetEventsFunctions().InsertNewEventsFunction(
+        "MyFunction", 0);
+    eventsBasedObject.GetPropertyDescriptors().InsertNew("MyProperty", 0);
+    eventsBasedObject
+        .InsertNewObject(project, "MyExtension::Sprite", "MyChildObject", 0)
+        .AddNewBehavior(
+            project, "MyExtension::MyBehavior", "MyDefaultBehavior")
+        ->SetDefaultBehavior(true);
+
+    gd::Project strippedProject = project;
+    gd::ProjectStripper::StripProjectForExport(strippedProject);
+    gd::SerializerElement strippedProjectElement;
+    strippedProject.SerializeTo(strippedProjectElement);
+
+    gd::SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    gd::ProjectStripper::StripSerializedProjectForExport(project,
+                                                         projectElement);
+
+    // Copying a project does not copy its objects folders, which are not
+    // used by exports anyway.
+    RemoveObjectsFolderStructures(projectElement);
+    RemoveObjectsFolderStructures(strippedProjectElement);
+    REQUIRE(gd::Serializer::ToJSON(projectElement) ==
+            gd::Serializer::ToJSON(strippedProjectElement));
+
+    // The project itself is not stripped.
+    REQUIRE(project.GetObjectGroups().size() == 1);
+    REQUIRE(project.GetExternalEventsCount() == 1);
+    REQUIRE(project.GetEventsFunctionsExtensionsCount() == 2);
+    REQUIRE(layout.GetEvents().GetEventsCount() == 1);
+    REQUIRE(object.GetBehavior("MyDefaultBehavior").IsDefaultBehavior());
+    REQUIRE(eventsBasedObject.GetEventsFunctions().GetEventsFunctionsCount() ==
+            1);
+  }
+}
@@ -32,4 +32,40 @@ TEST_CASE("Resources", "[common][resources]") {
     image.SetFile("Lots\\\\Of\\\\\\..\\Backslashs");
     REQUIRE(image.GetFile() == "Lots//Of///../Backslashs");
   }
+
+  SECTION("Find resources by their names in a large list") {
+    gd::ResourcesManager resourcesManager;
+    for (std::size_t i = 0; i < 100; ++i) {
+      resourcesManager.AddResource("Resource" + gd::String::From(i),
+                                   "resource.png", "image");
+    }
+    REQUIRE(resourcesManager.HasResource("Resource42"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource42") == 42);
+    REQUIRE(resourcesManager.GetResource("Resource42").GetName() ==
+            "Resource42");
+    REQUIRE(!resourcesManager.HasResource("Resource100"));
+
+    // An existing resource can't be added again.
+    REQUIRE(!resourcesManager.AddResource("Resource99", "other.png", "image"));
+
+    resourcesManager.MoveResource(42, 0);
+    REQUIRE(resourcesManager.GetResourcePosition("Resource42") == 0);
+    resourcesManager.MoveResourceDownInList("Resource42");
+    REQUIRE(resourcesManager.GetResourcePosition("Resource42") == 1);
+    resourcesManager.RemoveResource("Resource0");
+    REQUIRE(!resourcesManager.HasResource("Resource0"));
+    REQUIRE(resourcesManager.GetResourcePosition("Resource42") == 0);
+
+    resourcesManager.RenameResource("Resource42", "MyRenamedResource");
+    REQUIRE(!resourcesManager.HasResource("Resource42"));
+    REQUIRE(resourcesManager.GetResourcePosition("MyRenamedResource") == 0);
+    resourcesManager.GetResource("Resource43").SetName("MyOtherResource");
+    REQUIRE(!resourcesManager.HasResource("Resource43"));
+    REQUIRE(resourcesManager.HasResource("MyOtherResource"));
+
+    gd::ResourcesManager copiedResourcesManager = resourcesManager;
+    copiedResourcesManager.RemoveResource("MyOtherResource");
+    REQUIRE(!copiedResourcesManager.HasResource("MyOtherResource"));
+    REQUIRE(resourcesManager.HasResource("MyOtherResource"));
+  }
 }
@@ -7,6 +7,9 @@
  * @file Tests covering serialization to JSON.
  */
 #include "GDCore/Serialization/Serializer.h"
+
+#include <sstream>
+
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/Builtin/StandardEvent.h"
 #include "GDCore/Events/Event.h"
@@ -81,6 +84,95 @@ TEST_CASE("SerializerElement", "[common]") {
     REQUIRE(element.GetChild(2).GetDoubleValue() == 45.6);
   }
 
+  SECTION("Accessing children of elements with a lot of children") {
+    SerializerElement element;
+    for (std::size_t i = 0; i < 100; ++i) {
+      element.AddChild("child" + gd::String::From(i)).SetIntValue(i);
+    }
+    element.AddChild("child42").SetIntValue(4242);
+    element.AddChild("oldName").SetIntValue(-1);
+
+    REQUIRE(element.GetAllChildren().size() == 101);
+    REQUIRE(element.GetChild("child0").GetIntValue() == 0);
+    REQUIRE(element.GetChild("child42").GetIntValue() == 4242);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+    REQUIRE(element.HasChild("child100") == false);
+    REQUIRE(element.HasChild("newName", "oldName") == true);
+    REQUIRE(element.GetChild("newName", 0, "oldName").GetIntValue() == -1);
+    REQUIRE(element.GetChildrenCount("child42") == 1);
+
+    // Removing a child keeps the others accessible.
+    element.RemoveChild("child42");
+    REQUIRE(element.HasChild("child42") == false);
+    REQUIRE(element.GetChild("child43").GetIntValue() == 43);
+    element.AddChild("child42").SetIntValue(42);
+    REQUIRE(element.GetChild("child42").GetIntValue() == 42);
+    REQUIRE(element.GetAllChildren().back().first == "child42");
+
+    // Setting an attribute removes the child with the same name.
+    element.SetIntAttribute("child10", 10);
+    REQUIRE(element.HasChild("child10") == false);
+    REQUIRE(element.GetChild("child11").GetIntValue() == 11);
+
+    SerializerElement copiedElement = element;
+    REQUIRE(copiedElement.GetChild("child99").GetIntValue() == 99);
+    copiedElement.AddChild("child99").SetIntValue(-99);
+    REQUIRE(copiedElement.GetChild("child99").GetIntValue() == -99);
+    REQUIRE(element.GetChild("child99").GetIntValue() == 99);
+  }
+
+  SECTION("Accessing children of arrays with a lot of children") {
+    SerializerElement element;
+    element.ConsiderAsArray();
+    for (std::size_t i = 0; i < 100; ++i) {
+      element.AddChild("").SetIntValue(i);
+    }
+    element.ConsiderAsArrayOf("item", "oldItem");
+
+    REQUIRE(element.GetChildrenCount() == 100);
+    REQUIRE(element.GetChild(0).GetIntValue() == 0);
+    REQUIRE(element.GetChild(57).GetIntValue() == 57);
+    REQUIRE(element.GetChild("item", 99).GetIntValue() == 99);
+
+    // Named and unnamed children are mixed, in their order.
+    element.AddChild("item").SetIntValue(100);
+    REQUIRE(element.GetChildrenCount() == 101);
+    REQUIRE(element.GetChild(100).GetIntValue() == 100);
+    REQUIRE(element.GetChild(99).GetIntValue() == 99);
+  }
+
+  SECTION("Children allocated from an arena") {
+    std::shared_ptr<SerializerElement> keptChild;
+    {
+      SerializerElement element;
+      element.UseArenaAllocation();
+      REQUIRE(element.IsUsingArenaAllocation());
+      for (std::size_t i = 0; i < 1000; ++i) {
+        SerializerElement &child =
+            element.AddChild("child" + gd::String::From(i));
+        child.AddChild("value").SetIntValue(i);
+        REQUIRE(child.IsUsingArenaAllocation());
+      }
+      REQUIRE(element.GetChild("child999").GetChild("value").GetIntValue() ==
+              999);
+
+      // Copies are not allocated from the arena of the copied element.
+      SerializerElement copiedElement = element;
+      REQUIRE(copiedElement.IsUsingArenaAllocation() == false);
+      REQUIRE(Serializer::ToJSON(copiedElement) == Serializer::ToJSON(element));
+
+      // Children can be removed (their memory is only released with the
+      // arena).
+      element.RemoveChild("child500");
+      REQUIRE(element.HasChild("child500") == false);
+
+      keptChild = element.GetAllChildren()[42].second;
+    }
+
+    // The arena is kept alive as long as a child is alive.
+    REQUIRE(keptChild->GetChild("value").GetIntValue() == 42);
+  }
+
   SECTION("Multiline strings") {
     SerializerElement element;
 
@@ -206,6 +298,73 @@ TEST_CASE("Serializer", "[common]") {
     }
   }
 
+  SECTION("JSON written in an existing string or a stream") {
+    gd::String originalJSON =
+        u8"{\"hello\":{\"world\":[{},[],3,\"4\"],\"world2\":[-1,\"-2\","
+        u8"{\"-3\":[-4]}]},\"Hello 官话 world\":\"官话\"}";
+    SerializerElement element = Serializer::FromJSON(originalJSON);
+
+    gd::String output = "data = ";
+    Serializer::ToJSON(element, output);
+    REQUIRE(output == "data = " + originalJSON);
+
+    std::ostringstream stream;
+    Serializer::ToJSON(element, stream);
+    REQUIRE(stream.str() == originalJSON.Raw());
+  }
+
+  SECTION("Parse errors") {
+    JSONParseError error;
+    SerializerElement element =
+        Serializer::FromJSON("{\"ok\":true,\"hello\":}", error);
+    REQUIRE(error.HasError() == true);
+    REQUIRE(error.offset == 19);
+    REQUIRE(error.message == "Invalid value.");
+    REQUIRE(element.HasChild("ok") == false);
+
+    SerializerElement element2 = Serializer::FromJSON("{\"ok\":true}", error);
+    REQUIRE(error.HasError() == false);
+    REQUIRE(element2.GetChild("ok").GetBoolValue() == true);
+
+    SerializerElement element3 = Serializer::FromJSON("", error);
+    REQUIRE(error.HasError() == false);
+    REQUIRE(element3.IsValueUndefined() == true);
+  }
+
+  SECTION("JSON read by chunks") {
+    gd::String originalJSON =
+        u8"{\"hello\":{\"world\":[{},[],3,\"4\"],\"world2\":[-1,\"-2\","
+        u8"{\"-3\":[-4]}]},\"Hello 官话 world\":\"官话\"}";
+    auto unserializeByChunks = [](const gd::String& json,
+                                  std::size_t chunkSize,
+                                  JSONParseError& error) {
+      const std::string& raw = json.Raw();
+      std::size_t position = 0;
+      return Serializer::FromJSONChunks(
+          [&](char* buffer, std::size_t bufferSize) {
+            std::size_t size = std::min(
+                std::min(chunkSize, bufferSize), raw.size() - position);
+            raw.copy(buffer, size, position);
+            position += size;
+            return size;
+          },
+          error);
+    };
+
+    for (std::size_t chunkSize : {1, 3, 7, 1000}) {
+      JSONParseError error;
+      SerializerElement element =
+          unserializeByChunks(originalJSON, chunkSize, error);
+      REQUIRE(error.HasError() == false);
+      REQUIRE(Serializer::ToJSON(element) == originalJSON);
+    }
+
+    JSONParseError error;
+    unserializeByChunks("[1,2,", 2, error);
+    REQUIRE(error.HasError() == true);
+    REQUIRE(error.offset == 5);
+  }
+
   SECTION("(Deprecated) attributes") {
     gd::String originalJSON = "{\"ok\":true,\"hello\":\"world\"}";
     SerializerElement element = Serializer::FromJSON(originalJSON);
@@ -0,0 +1,276 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-2016 Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+
+#include "DummyPlatform.h"
+#include "GDCore/Extensions/Platform.h"
+#include "GDCore/Project/Layout.h"
+#include "GDCore/Project/Project.h"
+#include "GDCore/Serialization/BinarySerializer.h"
+#include "GDCore/Serialization/BinarySerializerReader.h"
+#include "GDCore/Serialization/Serializer.h"
+#include "GDCore/Serialization/SerializerElement.h"
+#include "GDCore/Serialization/rapidjson/document.h"
+#include "GDCore/Serialization/rapidjson/stringbuffer.h"
+#include "GDCore/Serialization/rapidjson/writer.h"
+#include "catch.hpp"
+
+namespace {
+std::atomic<std::size_t> allocationsCount(0);
+}  // namespace
+
+/**
+ * Replace the global allocation functions to count the allocations done
+ * during the benchmarks.
+ */
+void *operator new(std::size_t size) {
+  allocationsCount++;
+  void *memory = std::malloc(size ? size : 1);
+  if (!memory) throw std::bad_alloc();
+  return memory;
+}
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+namespace {
+/**
+ * \brief The previous way of loading JSON: a copy of the input is parsed into
+ * a rapidjson document, which is then converted to a gd::SerializerElement.
+ * Kept only to compare the performance of gd::Serializer::FromJSON.
+ */
+void DocumentValueToElement(const rapidjson::Value &value,
+                            gd::SerializerElement &element) {
+  if (value.IsBool()) {
+    element.SetBoolValue(value.GetBool());
+  } else if (value.IsInt64()) {
+    element.SetIntValue(value.GetInt64());
+  } else if (value.IsNumber()) {
+    element.SetValue(value.GetDouble());
+  } else if (value.IsString()) {
+    element.SetStringValue(value.GetString());
+  } else if (value.IsObject()) {
+    for (auto &m : value.GetObject()) {
+      DocumentValueToElement(m.value, element.AddChild(m.name.GetString()));
+    }
+  } else if (value.IsArray()) {
+    element.ConsiderAsArray();
+    for (auto &m : value.GetArray()) {
+      DocumentValueToElement(m, element.AddChild(""));
+    }
+  }
+}
+
+gd::SerializerElement FromJSONWithDocument(const gd::String &json) {
+  gd::SerializerElement element;
+  std::vector<char> buffer(json.Raw().begin(), json.Raw().end());
+  buffer.push_back('\0');
+  rapidjson::Document document;
+  if (document.ParseInsitu(buffer.data()).HasParseError()) return element;
+
+  DocumentValueToElement(document, element);
+  return element;
+}
+
+/**
+ * \brief The previous way of saving JSON: the element is converted to a
+ * rapidjson document, which is then written in a buffer copied to a string.
+ * Kept only to compare the performance of gd::Serializer::ToJSON.
+ */
+void ElementToDocumentValue(const gd::SerializerElement &element,
+                            rapidjson::Value &value,
+                            rapidjson::Document::AllocatorType &allocator) {
+  if (!element.IsValueUndefined()) {
+    const gd::SerializerValue &serializerValue = element.GetValue();
+    if (serializerValue.IsBoolean())
+      value.SetBool(serializerValue.GetBool());
+    else if (serializerValue.IsDouble())
+      value.SetDouble(serializerValue.GetDouble());
+    else if (serializerValue.IsInt())
+      value.SetInt(serializerValue.GetInt());
+    else if (serializerValue.IsString())
+      value.SetString(serializerValue.GetRawString().c_str(), allocator);
+  } else if (element.ConsideredAsArray()) {
+    value.SetArray();
+    for (const auto &child : element.GetAllChildren()) {
+      rapidjson::Value childValue;
+      ElementToDocumentValue(*child.second, childValue, allocator);
+      value.PushBack(childValue, allocator);
+    }
+  } else {
+    value.SetObject();
+    for (const auto &child : element.GetAllChildren()) {
+      rapidjson::Value name(child.first.c_str(), allocator);
+      rapidjson::Value childValue;
+      ElementToDocumentValue(*child.second, childValue, allocator);
+      value.AddMember(name, childValue, allocator);
+    }
+  }
+}
+
+gd::String ToJSONWithDocument(const gd::SerializerElement &element) {
+  rapidjson::Document document;
+  ElementToDocumentValue(element, document, document.GetAllocator());
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  document.Accept(writer);
+
+  return buffer.GetString();
+}
+
+gd::String MakeLargeProjectLikeJSON(std::size_t objectsCount) {
+  gd::SerializerElement root;
+  root.AddChild("firstLayout").SetStringValue("Scene");
+  gd::SerializerElement &objects = root.AddChild("objects");
+  objects.ConsiderAsArrayOf("object");
+  for (std::size_t i = 0; i < objectsCount; ++i) {
+    gd::SerializerElement &object = objects.AddChild("object");
+    object.AddChild("name").SetStringValue("MyObject" + gd::String::From(i));
+    object.AddChild("type").SetStringValue("Sprite");
+    object.AddChild("x").SetDoubleValue(i * 1.5);
+    object.AddChild("y").SetIntValue(i);
+    object.AddChild("visible").SetBoolValue(i % 2 == 0);
+    gd::SerializerElement &variables = object.AddChild("variables");
+    variables.ConsiderAsArrayOf("variable");
+    for (std::size_t j = 0; j < 5; ++j) {
+      gd::SerializerElement &variable = variables.AddChild("variable");
+      variable.AddChild("name").SetStringValue("Variable" +
+                                               gd::String::From(j));
+      variable.AddChild("value").SetStringValue(
+          u8"Some text with unicode characters: 官话");
+    }
+  }
+
+  return gd::Serializer::ToJSON(root);
+}
+}  // namespace
+
+TEST_CASE("Serializer - Benchmarks", "[common]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+    std::size_t allocationsCountBefore = allocationsCount;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds, "
+              << (allocationsCount - allocationsCountBefore) / runsCount
+              << " allocations" << std::endl;
+  };
+
+  SECTION("Load large JSON") {
+    gd::String json = MakeLargeProjectLikeJSON(2000);
+
+    doBenchmark("FromJSON (streaming)", 5, [&]() {
+      gd::SerializerElement element = gd::Serializer::FromJSON(json);
+      REQUIRE(element.GetChild("objects").GetChildrenCount() == 2000);
+    });
+    doBenchmark("FromJSON (with an intermediate document)", 5, [&]() {
+      gd::SerializerElement element = FromJSONWithDocument(json);
+      REQUIRE(element.GetChild("objects").GetChildrenCount() == 2000);
+    });
+  }
+
+  SECTION("Save large JSON") {
+    gd::SerializerElement element =
+        gd::Serializer::FromJSON(MakeLargeProjectLikeJSON(2000));
+    gd::String expectedJSON = ToJSONWithDocument(element);
+
+    doBenchmark("ToJSON (with an intermediate document)", 5, [&]() {
+      REQUIRE(ToJSONWithDocument(element) == expectedJSON);
+    });
+    doBenchmark("ToJSON (streaming)", 5, [&]() {
+      REQUIRE(gd::Serializer::ToJSON(element) == expectedJSON);
+    });
+  }
+
+  SECTION("Load large binary data") {
+    gd::String json = MakeLargeProjectLikeJSON(2000);
+    std::vector<char> binary =
+        gd::BinarySerializer::ToBinary(gd::Serializer::FromJSON(json));
+
+    doBenchmark("FromJSON", 5, [&]() {
+      gd::SerializerElement element = gd::Serializer::FromJSON(json);
+      REQUIRE(element.GetChild("objects").GetChildrenCount() == 2000);
+    });
+    doBenchmark("FromBinary", 5, [&]() {
+      gd::SerializerElement element = gd::BinarySerializer::FromBinary(binary);
+      REQUIRE(element.GetChild("objects").GetChildrenCount() == 2000);
+    });
+    doBenchmark("BinarySerializerReader (lazy read of one child)", 5, [&]() {
+      gd::BinarySerializerReader reader(binary.data(), binary.size());
+      REQUIRE(reader.GetRootElement()
+                  .GetChild("objects")
+                  .GetChild(1999)
+                  .GetStringAttribute("name") == "MyObject1999");
+    });
+  }
+
+  SECTION("Build a large tree, with and without an arena") {
+    gd::SerializerElement element =
+        gd::Serializer::FromJSON(MakeLargeProjectLikeJSON(2000));
+
+    doBenchmark("Copy a large tree (one allocation per element)", 5, [&]() {
+      gd::SerializerElement copiedElement = element;
+      REQUIRE(copiedElement.GetChild("objects").GetChildrenCount() == 2000);
+    });
+    doBenchmark("Copy a large tree (elements allocated in an arena)", 5, [&]() {
+      gd::SerializerElement copiedElement;
+      copiedElement.UseArenaAllocation();
+      copiedElement = element;
+      REQUIRE(copiedElement.GetChild("objects").GetChildrenCount() == 2000);
+    });
+  }
+
+  SECTION("Load a project with thousands of objects") {
+    gd::Platform platform;
+    gd::Project project;
+    SetupProjectWithDummyPlatform(project, platform);
+    for (std::size_t i = 0; i < 3000; ++i) {
+      project.InsertNewObject(project, "MyExtension::Sprite",
+                              "MyGlobalObject" + gd::String::From(i),
+                              project.GetObjectsCount());
+    }
+    auto &layout = project.InsertNewLayout("Scene", 0);
+    for (std::size_t i = 0; i < 3000; ++i) {
+      layout.InsertNewObject(project, "MyExtension::Sprite",
+                             "MyObject" + gd::String::From(i),
+                             layout.GetObjectsCount());
+    }
+    gd::SerializerElement projectElement;
+    project.SerializeTo(projectElement);
+    gd::String json = gd::Serializer::ToJSON(projectElement);
+
+    doBenchmark("Serialize a project with thousands of objects", 3, [&]() {
+      gd::SerializerElement element;
+      project.SerializeTo(element);
+    });
+    doBenchmark("Unserialize a project with thousands of objects", 3, [&]() {
+      gd::SerializerElement element = gd::Serializer::FromJSON(json);
+      gd::Project readProject;
+      readProject.AddPlatform(platform);
+      readProject.UnserializeFrom(element);
+      REQUIRE(readProject.GetLayout(0).GetObjectsCount() == 3000);
+    });
+  }
+}
@@ -0,0 +1,152 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include <chrono>
+#include <numeric>
+
+#include "GDCore/String.h"
+#include "catch.hpp"
+
+namespace {
+gd::String MakeString(const gd::String &word, std::size_t count) {
+  gd::String str;
+  for (std::size_t i = 0; i < count; ++i) {
+    str += word;
+    str += " ";
+  }
+  return str;
+}
+}  // namespace
+
+TEST_CASE("String - Benchmarks", "[common][utf8]") {
+  auto doBenchmark = [](const gd::String &benchmarkName,
+                        const size_t runsCount,
+                        std::function<void()> func) {
+    std::vector<long long> timesInMicroseconds;
+
+    for (size_t i = 0; i < runsCount; i++) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto end = std::chrono::steady_clock::now();
+
+      timesInMicroseconds.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+              .count());
+    }
+
+    std::cout << benchmarkName << " benchmark (" << runsCount << " runs): "
+              << (float)std::accumulate(timesInMicroseconds.begin(),
+                                        timesInMicroseconds.end(),
+                                        0) /
+                     (float)runsCount
+              << " microseconds" << std::endl;
+  };
+
+  const gd::String asciiStr = MakeString("MyObject.Variable(Counter)", 400);
+  const gd::String nonASCIIStr = MakeString(u8"MonObjet.Variable(Épée)", 400);
+
+  SECTION("Length and element access") {
+    doBenchmark("Get the size of an ASCII string in a loop", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < asciiStr.size(); ++i) count++;
+      REQUIRE(count == asciiStr.size());
+    });
+    doBenchmark("Get the size of a non ASCII string in a loop", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < nonASCIIStr.size(); ++i) count++;
+      REQUIRE(count == nonASCIIStr.size());
+    });
+    doBenchmark("Access each character of an ASCII string", 10, [&]() {
+      std::size_t spacesCount = 0;
+      for (std::size_t i = 0; i < asciiStr.size(); ++i)
+        if (asciiStr[i] == U' ') spacesCount++;
+      REQUIRE(spacesCount == 400);
+    });
+    doBenchmark("Access each character of a non ASCII string", 10, [&]() {
+      std::size_t spacesCount = 0;
+      for (std::size_t i = 0; i < nonASCIIStr.size(); ++i)
+        if (nonASCIIStr[i] == U' ') spacesCount++;
+      REQUIRE(spacesCount == 400);
+    });
+  }
+
+  SECTION("Search and sub-strings") {
+    doBenchmark("Find all the occurrences in an ASCII string", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t pos = asciiStr.find("Counter"); pos != gd::String::npos;
+           pos = asciiStr.find("Counter", pos + 1))
+        count++;
+      REQUIRE(count == 400);
+    });
+    doBenchmark("Find all the occurrences in a non ASCII string", 10, [&]() {
+      std::size_t count = 0;
+      for (std::size_t pos = nonASCIIStr.find(u8"Épée");
+           pos != gd::String::npos;
+           pos = nonASCIIStr.find(u8"Épée", pos + 1))
+        count++;
+      REQUIRE(count == 400);
+    });
+    doBenchmark("Split an ASCII string with substr", 10, [&]() {
+      std::size_t count = 0;
+      std::size_t start = 0;
+      for (std::size_t pos = asciiStr.find(" "); pos != gd::String::npos;
+           pos = asciiStr.find(" ", start)) {
+        if (!asciiStr.substr(start, pos - start).empty()) count++;
+        start = pos + 1;
+      }
+      REQUIRE(count == 400);
+    });
+  }
+
+  SECTION("Construction and concatenation") {
+    doBenchmark("Construct strings from literals", 10, [&]() {
+      std::size_t size = 0;
+      for (std::size_t i = 0; i < 10000; ++i) {
+        gd::String str = "MyObject.Variable(Counter)";
+        size += str.size();
+      }
+      REQUIRE(size == 260000);
+    });
+    doBenchmark("Concatenate strings", 10, [&]() {
+      gd::String str;
+      for (std::size_t i = 0; i < 10000; ++i) {
+        str += "MyObject";
+        str += gd::String(".Variable");
+      }
+      REQUIRE(str.size() == 170000);
+    });
+    doBenchmark("Build strings with operator+", 10, [&]() {
+      const gd::String objectList = "gdjs.Scene1Code.GDMyObjectObjects1";
+      const gd::String functionName = "setX";
+      std::size_t size = 0;
+      for (std::size_t i = 0; i < 10000; ++i) {
+        gd::String str = "for(var i = 0, len = " + objectList +
+                         ".length ;i < len;++i) {\n    " + objectList +
+                         "[i]." + functionName + "(" + gd::String::From(i) +
+                         ");\n}\n";
+        size += str.size();
+      }
+      REQUIRE(size > 0);
+    });
+    doBenchmark("Build strings with Concat", 10, [&]() {
+      const gd::String objectList = "gdjs.Scene1Code.GDMyObjectObjects1";
+      const gd::String functionName = "setX";
+      std::size_t size = 0;
+      for (std::size_t i = 0; i < 10000; ++i) {
+        gd::String str = gd::String::Concat("for(var i = 0, len = ",
+                                            objectList,
+                                            ".length ;i < len;++i) {\n    ",
+                                            objectList,
+                                            "[i].",
+                                            functionName,
+                                            "(",
+                                            gd::String::From(i),
+                                            ");\n}\n");
+        size += str.size();
+      }
+      REQUIRE(size > 0);
+    });
+  }
+}
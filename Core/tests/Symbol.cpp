@@ -0,0 +1,77 @@
+/*
+ * GDevelop Core
+ * Copyright 2008-present Florian Rival (Florian.Rival@gmail.com). All rights
+ * reserved. This project is released under the MIT License.
+ */
+#include "GDCore/Tools/Symbol.h"
+
+#include <set>
+#include <unordered_map>
+
+#include "GDCore/Tools/ParallelFor.h"
+#include "catch.hpp"
+
+TEST_CASE("Symbol", "[common]") {
+  SECTION("Symbols of the same string share it") {
+    gd::String name = u8"MyObjectÉ";
+    gd::Symbol symbol(name);
+    gd::Symbol otherSymbol(gd::String(u8"MyObjectÉ"));
+
+    REQUIRE(symbol == otherSymbol);
+    REQUIRE(&symbol.GetString() == &otherSymbol.GetString());
+    REQUIRE(symbol.GetString() == name);
+    REQUIRE(symbol != gd::Symbol(gd::String("MyOtherObject")));
+
+    const gd::String &str = symbol;
+    REQUIRE(str == u8"MyObjectÉ");
+  }
+
+  SECTION("Empty symbol") {
+    gd::Symbol symbol;
+    REQUIRE(symbol.empty());
+    REQUIRE(symbol == gd::Symbol(gd::String("")));
+    REQUIRE(symbol.GetString() == "");
+  }
+
+  SECTION("Find existing symbols") {
+    gd::Symbol symbol(gd::String("FindExistingSymbol"));
+
+    gd::Symbol foundSymbol;
+    REQUIRE(gd::Symbol::FindExisting("FindExistingSymbol", foundSymbol));
+    REQUIRE(foundSymbol == symbol);
+    REQUIRE(!gd::Symbol::FindExisting("NeverInternedSymbol", foundSymbol));
+    REQUIRE(foundSymbol == symbol);
+    REQUIRE(gd::Symbol::FindExisting("", foundSymbol));
+    REQUIRE(foundSymbol.empty());
+  }
+
+  SECTION("Use symbols as keys") {
+    // Ordered by their strings, whatever the order of interning.
+    std::set<gd::Symbol> symbols;
+    symbols.insert(gd::Symbol(gd::String("SymbolC")));
+    symbols.insert(gd::Symbol(gd::String("SymbolA")));
+    symbols.insert(gd::Symbol(gd::String("SymbolB")));
+    symbols.insert(gd::Symbol(gd::String("SymbolA")));
+    REQUIRE(symbols.size() == 3);
+    REQUIRE(symbols.begin()->GetString() == "SymbolA");
+    REQUIRE(symbols.rbegin()->GetString() == "SymbolC");
+
+    std::unordered_map<gd::Symbol, int> values;
+    values[gd::Symbol(gd::String("SymbolA"))] = 1;
+    values[gd::Symbol(gd::String("SymbolB"))] = 2;
+    REQUIRE(values[gd::Symbol(gd::String("SymbolA"))] == 1);
+    REQUIRE(values.size() == 2);
+  }
+
+  SECTION("Intern strings from several threads") {
+    std::vector<gd::Symbol> symbols(1000);
+    gd::ParallelFor(symbols.size(), [&symbols](std::size_t i) {
+      symbols[i] = gd::Symbol("ConcurrentSymbol" + gd::String::From(i % 10));
+    });
+
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+      REQUIRE(symbols[i] ==
+              gd::Symbol("ConcurrentSymbol" + gd::String::From(i % 10)));
+    }
+  }
+}
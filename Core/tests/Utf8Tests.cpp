@@ -34,6 +34,56 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(str.size() == 18);
   }
 
+  SECTION("size after modifications") {
+    gd::String str = u8"UTF8 a été testé !";
+    REQUIRE(str.size() == 18);
+
+    str += u8" Encore été";
+    REQUIRE(str.size() == 29);
+    str += gd::String(u8" déjà");
+    REQUIRE(str.size() == 34);
+    str.push_back(U'é');
+    REQUIRE(str.size() == 35);
+    str.pop_back();
+    REQUIRE(str.size() == 34);
+    str.insert(0, u8"Été ");
+    REQUIRE(str.size() == 38);
+    str.erase(0, 4);
+    REQUIRE(str.size() == 34);
+    str.replace(0, 4, u8"à");
+    REQUIRE(str.size() == 31);
+    str.Raw() += u8"é";
+    REQUIRE(str.size() == 32);
+
+    gd::String copiedStr = str;
+    REQUIRE(copiedStr.size() == 32);
+    gd::String movedStr = std::move(str);
+    REQUIRE(movedStr.size() == 32);
+    REQUIRE(str.size() == 0);
+    REQUIRE(str.empty());
+    str = movedStr;
+    REQUIRE(str.size() == 32);
+    str = u8"été";
+    REQUIRE(str.size() == 3);
+    str.clear();
+    REQUIRE(str.size() == 0);
+  }
+
+  SECTION("element access") {
+    gd::String str = u8"UTF8 a été testé !";
+    REQUIRE(str[0] == U'U');
+    REQUIRE(str[8] == U't');
+    REQUIRE(str[9] == U'é');
+    REQUIRE(str[17] == U'!');
+
+    gd::String asciiStr = "ASCII only";
+    REQUIRE(asciiStr[0] == U'A');
+    REQUIRE(asciiStr[9] == U'y');
+    asciiStr += u8" (or not: é)";
+    REQUIRE(asciiStr[20] == U'é');
+    REQUIRE(asciiStr[21] == U')');
+  }
+
   SECTION("substr") {
     gd::String str = u8"UTF8 a été testé !";
 
@@ -130,6 +180,21 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(str.find(u8"té", 9) == 14);
     REQUIRE(str.find(u8"té", 14) == 14);
     REQUIRE(str.find(u8"té", 15) == gd::String::npos);
+
+    gd::String asciiStr = "ASCII is tested";
+    REQUIRE(asciiStr.find("te", 0) == 9);
+    REQUIRE(asciiStr.find("te", 10) == 12);
+    REQUIRE(asciiStr.find("te", 13) == gd::String::npos);
+    REQUIRE(asciiStr.find("te", 50) == gd::String::npos);
+    REQUIRE(asciiStr.rfind("te", gd::String::npos) == 12);
+    REQUIRE(asciiStr.rfind("te", 11) == 9);
+    REQUIRE(asciiStr.rfind("te", 8) == gd::String::npos);
+    REQUIRE(asciiStr.substr(6, 2) == "is");
+    REQUIRE(asciiStr.substr(9) == "tested");
+    REQUIRE(asciiStr.substr(15) == "");
+    #if !defined(WINDOWS)
+      REQUIRE_THROWS_AS(asciiStr.substr(16, 5), std::out_of_range);
+    #endif
   }
 
   SECTION("rfind") {
@@ -218,6 +283,33 @@ TEST_CASE("Utf8 String", "[common][utf8]") {
     REQUIRE(str3 == u8"Début d'une chaîne, suite et fin encore un peu.");
   }
 
+  SECTION("operator+") {
+    gd::String str = u8"Épée";
+    gd::String str2 = u8"à deux mains";
+
+    REQUIRE((str + " " + str2) == u8"Épée à deux mains");
+    REQUIRE((str + gd::String(" ") + str2) == u8"Épée à deux mains");
+    REQUIRE((str + (" " + str2)) == u8"Épée à deux mains");
+    REQUIRE(("(" + str + ")") == u8"(Épée)");
+    REQUIRE(("(" + (str + ")")) == u8"(Épée)");
+    REQUIRE((gd::String("(") + gd::String(str)) == u8"(Épée");
+    REQUIRE((str + " " + str2).size() == 17);
+    REQUIRE(("(" + (str + ")")).size() == 6);
+
+    // The operands are left untouched.
+    REQUIRE(str == u8"Épée");
+    REQUIRE(str2 == u8"à deux mains");
+  }
+
+  SECTION("Concat") {
+    gd::String str = u8"Épée";
+    gd::String result = gd::String::Concat("(", str, ", ", str, u8") à ", "");
+    REQUIRE(result == u8"(Épée, Épée) à ");
+    REQUIRE(result.size() == 15);
+    REQUIRE(gd::String::Concat() == "");
+    REQUIRE(gd::String::Concat(gd::String::From(42), "px") == "42px");
+  }
+
   SECTION("push_back/pop_back") {
     gd::String str = u8"This is a sentence";
 
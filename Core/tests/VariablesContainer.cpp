@@ -49,4 +49,35 @@ TEST_CASE("VariablesContainer", "[common][variables]") {
             "Hello second copied World");
     REQUIRE(container3.Get("Variable2").GetValue() == 44);
   }
+
+  SECTION("Find variables by their names in a large container") {
+    gd::VariablesContainer container;
+    for (std::size_t i = 0; i < 100; ++i) {
+      container.InsertNew("Variable" + gd::String::From(i), container.Count())
+          .SetValue(i);
+    }
+    REQUIRE(container.Has("Variable42"));
+    REQUIRE(container.GetPosition("Variable42") == 42);
+    REQUIRE(container.Get("Variable42").GetValue() == 42);
+    REQUIRE(!container.Has("Variable100"));
+
+    container.InsertNew("MyNewVariable", 0);
+    REQUIRE(container.GetPosition("MyNewVariable") == 0);
+    REQUIRE(container.GetPosition("Variable42") == 43);
+    container.Swap(0, 43);
+    REQUIRE(container.GetPosition("Variable42") == 0);
+    container.Move(0, 43);
+    REQUIRE(container.GetPosition("Variable42") == 43);
+    container.Remove("MyNewVariable");
+    REQUIRE(!container.Has("MyNewVariable"));
+    REQUIRE(container.GetPosition("Variable42") == 42);
+
+    REQUIRE(container.Rename("Variable42", "MyRenamedVariable"));
+    REQUIRE(!container.Has("Variable42"));
+    REQUIRE(container.Get("MyRenamedVariable").GetValue() == 42);
+    REQUIRE(!container.Rename("Variable43", "MyRenamedVariable"));
+
+    container.Clear();
+    REQUIRE(!container.Has("Variable43"));
+  }
 }
@@ -671,15 +671,17 @@ gd::String EventsCodeGenerator::GenerateObjectFunctionCall(
     gd::EventsCodeGenerationContext& context) {
   if (codeInfo.staticFunction)
     return "(" + codeInfo.functionCallName + "(" + parametersStr + "))";
+  gd::String objectList = GetObjectListName(objectListName, context);
   if (context.GetCurrentObject() == objectListName &&
       !context.GetCurrentObject().empty())
-    return "(" + GetObjectListName(objectListName, context) + "[i]." +
-           codeInfo.functionCallName + "(" + parametersStr + "))";
+    return gd::String::Concat("(", objectList, "[i].",
+                              codeInfo.functionCallName, "(", parametersStr,
+                              "))");
   else
-    return "(( " + GetObjectListName(objectListName, context) +
-           ".length === 0 ) ? " + defaultOutput + " :" +
-           GetObjectListName(objectListName, context) + "[0]." +
-           codeInfo.functionCallName + "(" + parametersStr + "))";
+    return gd::String::Concat("(( ", objectList, ".length === 0 ) ? ",
+                              defaultOutput, " :", objectList, "[0].",
+                              codeInfo.functionCallName, "(", parametersStr,
+                              "))");
 }
 
 gd::String EventsCodeGenerator::GenerateObjectBehaviorFunctionCall(
@@ -692,17 +694,20 @@ gd::String EventsCodeGenerator::GenerateObjectBehaviorFunctionCall(
     gd::EventsCodeGenerationContext& context) {
   if (codeInfo.staticFunction)
     return "(" + codeInfo.functionCallName + "(" + parametersStr + "))";
+  gd::String objectList = GetObjectListName(objectListName, context);
   if (context.GetCurrentObject() == objectListName &&
       !context.GetCurrentObject().empty())
-    return "(" + GetObjectListName(objectListName, context) +
-           "[i].getBehavior(" + GenerateGetBehaviorNameCode(behaviorName) +
-           ")." + codeInfo.functionCallName + "(" + parametersStr + "))";
+    return gd::String::Concat("(", objectList, "[i].getBehavior(",
+                              GenerateGetBehaviorNameCode(behaviorName), ").",
+                              codeInfo.functionCallName, "(", parametersStr,
+                              "))");
   else
-    return "(( " + GetObjectListName(objectListName, context) +
-           ".length === 0 ) ? " + defaultOutput + " :" +
-           GetObjectListName(objectListName, context) + "[0].getBehavior(" +
-           GenerateGetBehaviorNameCode(behaviorName) + ")." +
-           codeInfo.functionCallName + "(" + parametersStr + "))";
+    return gd::String::Concat("(( ", objectList, ".length === 0 ) ? ",
+                              defaultOutput, " :", objectList,
+                              "[0].getBehavior(",
+                              GenerateGetBehaviorNameCode(behaviorName), ").",
+                              codeInfo.functionCallName, "(", parametersStr,
+                              "))");
 }
 
 gd::String EventsCodeGenerator::GenerateFreeCondition(
@@ -720,8 +725,9 @@ gd::String EventsCodeGenerator::GenerateFreeCondition(
         arguments,
         instrInfos.codeExtraInformation.functionCallName);
   } else {
-    predicate = instrInfos.codeExtraInformation.functionCallName + "(" +
-                GenerateArgumentsList(arguments) + ")";
+    predicate = gd::String::Concat(
+        instrInfos.codeExtraInformation.functionCallName, "(",
+        GenerateArgumentsList(arguments), ")");
   }
 
   // Add logical not if needed
@@ -736,8 +742,8 @@ gd::String EventsCodeGenerator::GenerateFreeCondition(
     predicate = GenerateNegatedPredicate(predicate);
 
   // Generate condition code
-  return GenerateBooleanFullName(returnBoolean, context) + " = " + predicate +
-         ";\n";
+  return gd::String::Concat(
+      GenerateBooleanFullName(returnBoolean, context), " = ", predicate, ";\n");
 }
 
 gd::String EventsCodeGenerator::GenerateObjectCondition(
@@ -751,9 +757,9 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(
   gd::String conditionCode;
 
   // Prepare call
-  gd::String objectFunctionCallNamePart =
-      GetObjectListName(objectName, context) + "[i]." +
-      instrInfos.codeExtraInformation.functionCallName;
+  gd::String objectList = GetObjectListName(objectName, context);
+  gd::String objectFunctionCallNamePart = gd::String::Concat(
+      objectList, "[i].", instrInfos.codeExtraInformation.functionCallName);
 
   // Create call
   gd::String predicate;
@@ -762,25 +768,21 @@ gd::String EventsCodeGenerator::GenerateObjectCondition(
     predicate = GenerateRelationalOperatorCall(
         instrInfos, arguments, objectFunctionCallNamePart, 1);
   } else {
-    predicate = objectFunctionCallNamePart + "(" +
-                GenerateArgumentsList(arguments, 1) + ")";
+    predicate = gd::String::Concat(objectFunctionCallNamePart, "(",
+                                   GenerateArgumentsList(arguments, 1), ")");
   }
   if (conditionInverted) predicate = GenerateNegatedPredicate(predicate);
 
   // Generate whole condition code
-  conditionCode +=
-      "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
-      ".length;i<l;++i) {\n";
-  conditionCode += "    if ( " + predicate + " ) {\n";
-  conditionCode += "        " +
-                   GenerateBooleanFullName(returnBoolean, context) +
-                   " = true;\n";
-  conditionCode += "        " + GetObjectListName(objectName, context) +
-                   "[k] = " + GetObjectListName(objectName, context) + "[i];\n";
-  conditionCode += "        ++k;\n";
-  conditionCode += "    }\n";
-  conditionCode += "}\n";
-  conditionCode += GetObjectListName(objectName, context) + ".length = k;\n";
+  conditionCode = gd::String::Concat(
+      "for (var i = 0, k = 0, l = ", objectList, ".length;i<l;++i) {\n",
+      "    if ( ", predicate, " ) {\n",
+      "        ", GenerateBooleanFullName(returnBoolean, context), " = true;\n",
+      "        ", objectList, "[k] = ", objectList, "[i];\n",
+      "        ++k;\n",
+      "    }\n",
+      "}\n",
+      objectList, ".length = k;\n");
 
   return conditionCode;
 }
@@ -797,10 +799,10 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
   gd::String conditionCode;
 
   // Prepare call
-  gd::String objectFunctionCallNamePart =
-      GetObjectListName(objectName, context) + "[i].getBehavior(" +
-      GenerateGetBehaviorNameCode(behaviorName) + ")." +
-      instrInfos.codeExtraInformation.functionCallName;
+  gd::String objectList = GetObjectListName(objectName, context);
+  gd::String objectFunctionCallNamePart = gd::String::Concat(
+      objectList, "[i].getBehavior(", GenerateGetBehaviorNameCode(behaviorName),
+      ").", instrInfos.codeExtraInformation.functionCallName);
 
   // Create call
   gd::String predicate;
@@ -809,8 +811,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
     predicate = GenerateRelationalOperatorCall(
         instrInfos, arguments, objectFunctionCallNamePart, 2);
   } else {
-    predicate = objectFunctionCallNamePart + "(" +
-                GenerateArgumentsList(arguments, 2) + ")";
+    predicate = gd::String::Concat(objectFunctionCallNamePart, "(",
+                                   GenerateArgumentsList(arguments, 2), ")");
   }
   if (conditionInverted) predicate = GenerateNegatedPredicate(predicate);
 
@@ -823,20 +825,15 @@ gd::String EventsCodeGenerator::GenerateBehaviorCondition(
          << "\" requested for object \'" << objectName
          << "\" (condition: " << instrInfos.GetFullName() << ")." << endl;
   } else {
-    conditionCode +=
-        "for (var i = 0, k = 0, l = " + GetObjectListName(objectName, context) +
-        ".length;i<l;++i) {\n";
-    conditionCode += "    if ( " + predicate + " ) {\n";
-    conditionCode += "        " +
-                     GenerateBooleanFullName(returnBoolean, context) +
-                     " = true;\n";
-    conditionCode += "        " + GetObjectListName(objectName, context) +
-                     "[k] = " + GetObjectListName(objectName, context) +
-                     "[i];\n";
-    conditionCode += "        ++k;\n";
-    conditionCode += "    }\n";
-    conditionCode += "}\n";
-    conditionCode += GetObjectListName(objectName, context) + ".length = k;\n";
+    conditionCode = gd::String::Concat(
+        "for (var i = 0, k = 0, l = ", objectList, ".length;i<l;++i) {\n",
+        "    if ( ", predicate, " ) {\n",
+        "        ", GenerateBooleanFullName(returnBoolean, context), " = true;\n",
+        "        ", objectList, "[k] = ", objectList, "[i];\n",
+        "        ++k;\n",
+        "    }\n",
+        "}\n",
+        objectList, ".length = k;\n");
   }
 
   return conditionCode;
@@ -870,7 +867,8 @@ gd::String EventsCodeGenerator::GenerateObjectAction(
   gd::String actionCode;
 
   // Prepare call
-  gd::String objectPart = GetObjectListName(objectName, context) + "[i].";
+  gd::String objectList = GetObjectListName(objectName, context);
+  gd::String objectPart = objectList + "[i].";
 
   // Create call
   gd::String call;
@@ -893,8 +891,8 @@ gd::String EventsCodeGenerator::GenerateObjectAction(
       call = GenerateCompoundOperatorCall(
           instrInfos, arguments, objectPart + functionCallName, 1);
   } else {
-    call = objectPart + functionCallName + "(" +
-           GenerateArgumentsList(arguments, 1) + ")";
+    call = gd::String::Concat(objectPart, functionCallName, "(",
+                              GenerateArgumentsList(arguments, 1), ")");
   }
 
   if (!optionalAsyncCallbackName.empty()) {
@@ -902,11 +900,10 @@ gd::String EventsCodeGenerator::GenerateObjectAction(
     call = "asyncTaskGroup.addTask(" + call + ")";
   }
 
-  actionCode +=
-      "for(var i = 0, len = " + GetObjectListName(objectName, context) +
-      ".length ;i < len;++i) {\n";
-  actionCode += "    " + call + ";\n";
-  actionCode += "}\n";
+  actionCode += gd::String::Concat("for(var i = 0, len = ", objectList,
+                                   ".length ;i < len;++i) {\n",
+                                   "    ", call, ";\n",
+                                   "}\n");
 
   if (!optionalAsyncCallbackName.empty()) {
     actionCode +=
@@ -929,9 +926,10 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
   gd::String actionCode;
 
   // Prepare call
-  gd::String objectPart = GetObjectListName(objectName, context) +
-                          "[i].getBehavior(" +
-                          GenerateGetBehaviorNameCode(behaviorName) + ").";
+  gd::String objectList = GetObjectListName(objectName, context);
+  gd::String objectPart = gd::String::Concat(
+      objectList, "[i].getBehavior(", GenerateGetBehaviorNameCode(behaviorName),
+      ").");
 
   // Create call
   gd::String call;
@@ -954,8 +952,8 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
       call = GenerateCompoundOperatorCall(
           instrInfos, arguments, objectPart + functionCallName, 2);
   } else {
-    call = objectPart + functionCallName + "(" +
-           GenerateArgumentsList(arguments, 2) + ")";
+    call = gd::String::Concat(objectPart, functionCallName, "(",
+                              GenerateArgumentsList(arguments, 2), ")");
   }
 
   // Verify that object has behavior.
@@ -972,11 +970,10 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
       call = "asyncTaskGroup.addTask(" + call + ")";
     }
 
-    actionCode +=
-        "for(var i = 0, len = " + GetObjectListName(objectName, context) +
-        ".length ;i < len;++i) {\n";
-    actionCode += "    " + call + ";\n";
-    actionCode += "}\n";
+    actionCode += gd::String::Concat("for(var i = 0, len = ", objectList,
+                                     ".length ;i < len;++i) {\n",
+                                     "    ", call, ";\n",
+                                     "}\n");
 
     if (!optionalAsyncCallbackName.empty()) {
       actionCode +=
@@ -990,8 +987,10 @@ gd::String EventsCodeGenerator::GenerateBehaviorAction(
 
 gd::String EventsCodeGenerator::GetObjectListName(
     const gd::String& name, const gd::EventsCodeGenerationContext& context) {
-  return GetCodeNamespaceAccessor() + ManObjListName(name) +
-         gd::String::From(context.GetLastDepthObjectListWasNeeded(name));
+  return gd::String::Concat(
+      GetCodeNamespaceAccessor(),
+      ManObjListName(name),
+      gd::String::From(context.GetLastDepthObjectListWasNeeded(name)));
 }
 
 gd::String EventsCodeGenerator::GenerateGetBehaviorNameCode(
@@ -1039,13 +1038,14 @@ gd::String EventsCodeGenerator::GenerateObjectsDeclarationCode(
   for (auto object : context.GetObjectsListsToBeDeclared()) {
     gd::String objectListDeclaration = "";
     if (!context.ObjectAlreadyDeclaredByParents(object)) {
-      objectListDeclaration += "gdjs.copyArray(" +
-                               GenerateAllInstancesGetterCode(object, context) +
-                               ", " + GetObjectListName(object, context) + ");";
+      objectListDeclaration = gd::String::Concat(
+          "gdjs.copyArray(", GenerateAllInstancesGetterCode(object, context),
+          ", ", GetObjectListName(object, context), ");");
     } else
       objectListDeclaration = declareObjectListFromParent(object, context);
 
-    declarationsCode += objectListDeclaration + "\n";
+    declarationsCode += objectListDeclaration;
+    declarationsCode += "\n";
   }
   for (auto object : context.GetObjectsListsToBeEmptyIfJustDeclared()) {
     gd::String objectListDeclaration = "";
@@ -1083,8 +1083,10 @@ gd::String EventsCodeGenerator::GenerateAllInstancesGetterCode(
   }
 }
 
-gd::String EventsCodeGenerator::GenerateEventsListCode(
-    gd::EventsList& events, gd::EventsCodeGenerationContext& context) {
+void EventsCodeGenerator::AppendEventsListCode(
+    gd::EventsList& events,
+    gd::EventsCodeGenerationContext& context,
+    gd::String& output) {
   // *Optimization*: generating all JS code of events in a single, enormous
   // function is badly handled by JS engines and in particular the garbage
   // collectors, leading to intermittent lag/freeze while the garbage collector
@@ -1092,8 +1094,8 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // stress on the JS engines, we generate a new function for each list of
   // events.
 
-  gd::String code =
-      gd::EventsCodeGenerator::GenerateEventsListCode(events, context);
+  gd::String code;
+  gd::EventsCodeGenerator::AppendEventsListCode(events, context, code);
 
   gd::String parametersCode = GenerateEventsParameters(context);
 
@@ -1107,13 +1109,26 @@ gd::String EventsCodeGenerator::GenerateEventsListCode(
   // List of objects, conditions booleans and any variables used by events
   // are stored in static variables that are globally available by the whole
   // code.
-  AddCustomCodeOutsideMain(functionName + " = function(" + parametersCode +
-                           ") {\n" + code + "\n" + "};");
+  // The function is composed in a single string, so that the code of the
+  // events is only copied once before being added outside main.
+  gd::String functionCode;
+  functionCode.reserve(functionName.size() + parametersCode.size() +
+                       code.size() + 20);
+  functionCode += functionName;
+  functionCode += " = function(";
+  functionCode += parametersCode;
+  functionCode += ") {\n";
+  functionCode += code;
+  functionCode += "\n};";
+  AddCustomCodeOutsideMain(functionCode);
 
   // Replace the code of the events by the call to the function. This does not
   // interfere with the objects picking as the lists are in static variables
   // globally available.
-  return functionName + "(" + parametersCode + ");";
+  output += functionName;
+  output += "(";
+  output += parametersCode;
+  output += ");";
 }
 
 gd::String EventsCodeGenerator::GenerateConditionsListCode(
@@ -1376,7 +1391,8 @@ gd::String EventsCodeGenerator::GenerateBooleanInitializationToFalse(
 gd::String EventsCodeGenerator::GenerateBooleanFullName(
     const gd::String& boolName,
     const gd::EventsCodeGenerationContext& context) {
-  return boolName + "_" + gd::String::From(context.GetCurrentConditionDepth());
+  return gd::String::Concat(
+      boolName, "_", gd::String::From(context.GetCurrentConditionDepth()));
 }
 
 gd::String EventsCodeGenerator::GenerateProfilerSectionBegin(
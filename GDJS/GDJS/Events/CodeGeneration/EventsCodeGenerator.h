@@ -137,18 +137,20 @@ class EventsCodeGenerator : public gd::EventsCodeGenerator {
       bool compilationForRuntime = false);
 
   /**
-   * \brief Generate code for executing an event list
+   * \brief Generate code for executing an event list, appending it to the
+   * given output.
    * \note To reduce the stress on JS engines, the code is generated inside
    * a separate JS function (see
-   * gd::EventsCodeGenerator::AddCustomCodeOutsideMain). This method will return
+   * gd::EventsCodeGenerator::AddCustomCodeOutsideMain). This method will append
    * the code to call this separate function.
    *
    * \param events std::vector of events
    * \param context Context used for generation
-   * \return Code
+   * \param output The code to which the call to the function is appended.
    */
-  virtual gd::String GenerateEventsListCode(
-      gd::EventsList& events, gd::EventsCodeGenerationContext& context) override;
+  virtual void AppendEventsListCode(gd::EventsList& events,
+                                    gd::EventsCodeGenerationContext& context,
+                                    gd::String& output) override;
 
   /**
    * Generate code for executing a condition list
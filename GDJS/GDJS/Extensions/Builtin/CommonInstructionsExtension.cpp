@@ -150,8 +150,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         if (event.HasSubEvents())  // Sub events
         {
           actionsCode += "\n{ //Subevents\n";
-          actionsCode += codeGenerator.GenerateEventsListCode(
-              event.GetSubEvents(), actionsContext);
+          codeGenerator.AppendEventsListCode(
+              event.GetSubEvents(), actionsContext, actionsCode);
           actionsCode += "} //End of subevents\n";
         }
         gd::String actionsDeclarationsCode =
@@ -422,8 +422,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
         outputCode += "\n{ //Subevents: \n";
         // TODO: check (and heavily test) if sub events should be generated before
         // the call to GenerateObjectsDeclarationCode.
-        outputCode +=
-            codeGenerator.GenerateEventsListCode(event.GetSubEvents(), context);
+        codeGenerator.AppendEventsListCode(
+            event.GetSubEvents(), context, outputCode);
         outputCode += "} //Subevents end.\n";
         outputCode += "}\n";
         outputCode += "} else " + whileBoolean + " = true; \n";
@@ -813,8 +813,8 @@ CommonInstructionsExtension::CommonInstructionsExtension() {
 
         outputCode +=
             codeGenerator.GenerateProfilerSectionBegin(event.GetName());
-        outputCode +=
-            codeGenerator.GenerateEventsListCode(event.GetSubEvents(), context);
+        codeGenerator.AppendEventsListCode(
+            event.GetSubEvents(), context, outputCode);
         outputCode += codeGenerator.GenerateProfilerSectionEnd(event.GetName());
 
         return outputCode;
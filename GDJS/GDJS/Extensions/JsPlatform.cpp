@@ -67,133 +67,85 @@ gd::PlatformExtension *CreateGDJSParticleSystemExtension();
 }
 #endif
 
+namespace {
+template <class Extension>
+std::shared_ptr<gd::PlatformExtension> DeclareExtension() {
+  return std::shared_ptr<gd::PlatformExtension>(new Extension);
+}
+
+template <gd::PlatformExtension *(*createExtension)()>
+std::shared_ptr<gd::PlatformExtension> DeclareExtensionWith() {
+  return std::shared_ptr<gd::PlatformExtension>(createExtension());
+}
+}  // namespace
+
 void JsPlatform::ReloadBuiltinExtensions() {
-  // Adding built-in extensions.
-  std::cout << "* Loading builtin extensions... ";
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new BaseObjectExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SpriteExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AsyncExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new CommonConversionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new VariablesExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new MouseExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new KeyboardExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new SceneExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new TimeExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new MathematicalToolsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new CameraExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AudioExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new FileExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new NetworkExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new WindowExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new StringInstructionsExtension));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(new AdvancedExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ExternalLayoutsExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new AnimatableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new EffectExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new FlippableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ResizableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new ScalableExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new OpacityExtension));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(new TextContainerExtension));
-  std::cout.flush();
-  std::cout << "done." << std::endl;
+  // Extensions are declared when the platform is used for the first time (see
+  // gd::Platform::AddLazilyDeclaredExtension), so that creating the platform
+  // is fast.
+  AddLazilyDeclaredExtension(DeclareExtension<BaseObjectExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<SpriteExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<CommonInstructionsExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<AsyncExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<CommonConversionsExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<VariablesExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<MouseExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<KeyboardExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<SceneExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<TimeExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<MathematicalToolsExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<CameraExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<AudioExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<FileExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<NetworkExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<WindowExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<StringInstructionsExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<AdvancedExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<ExternalLayoutsExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<AnimatableExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<EffectExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<FlippableExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<ResizableExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<ScalableExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<OpacityExtension>);
+  AddLazilyDeclaredExtension(DeclareExtension<TextContainerExtension>);
 
 #if defined(EMSCRIPTEN) // When compiling with emscripten, hardcode extensions
                         // to load.
-  std::cout << "* Loading other extensions... ";
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPlatformBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDestroyOutsideBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTiledSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSDraggableBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTopDownMovementBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSTextObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSParticleSystemExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPanelSpriteObjectExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSAnchorBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPrimitiveDrawingExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSTextEntryObjectExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSInventoryExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSLinkedObjectsExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSSystemInfoExtension()));
-  std::cout.flush();
-  AddExtension(
-      std::shared_ptr<gd::PlatformExtension>(CreateGDJSShopifyExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPathfindingBehaviorExtension()));
-  std::cout.flush();
-  AddExtension(std::shared_ptr<gd::PlatformExtension>(
-      CreateGDJSPhysicsBehaviorExtension()));
-  std::cout.flush();
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSPlatformBehaviorExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSDestroyOutsideBehaviorExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSTiledSpriteObjectExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSDraggableBehaviorExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSTopDownMovementBehaviorExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSTextObjectExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSParticleSystemExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSPanelSpriteObjectExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSAnchorBehaviorExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSPrimitiveDrawingExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSTextEntryObjectExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSInventoryExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSLinkedObjectsExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSSystemInfoExtension>);
+  AddLazilyDeclaredExtension(DeclareExtensionWith<CreateGDJSShopifyExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSPathfindingBehaviorExtension>);
+  AddLazilyDeclaredExtension(
+      DeclareExtensionWith<CreateGDJSPhysicsBehaviorExtension>);
 #endif
-  std::cout << "done." << std::endl;
 };
 
 void JsPlatform::AddNewExtension(const gd::PlatformExtension &extension) {
@@ -18,6 +18,8 @@
 
 #include "GDCore/CommonTools.h"
 #include "GDCore/Events/CodeGeneration/EffectsCodeGenerator.h"
+#include "GDCore/Events/Parsers/ExpressionNodeCache.h"
+#include "GDCore/Events/Tools/EventsCodeNameMangler.h"
 #include "GDCore/Extensions/Metadata/DependencyMetadata.h"
 #include "GDCore/Extensions/Metadata/MetadataProvider.h"
 #include "GDCore/Extensions/Platform.h"
@@ -41,6 +43,9 @@
 #include "GDCore/TinyXml/tinyxml.h"
 #include "GDCore/Tools/Localization.h"
 #include "GDCore/Tools/Log.h"
+#include "GDCore/Tools/MakeUnique.h"
+#include "GDCore/Tools/ParallelFor.h"
+#include "GDCore/Tools/VersionWrapper.h"
 #include "GDJS/Events/CodeGeneration/LayoutCodeGenerator.h"
 #include "GDJS/Extensions/JsPlatform.h"
 #undef CopyFile  // Disable an annoying macro
@@ -61,6 +66,64 @@ double LogTimeSpent(const gd::String &name, double previousTime) {
   std::cout << std::endl;
   return GetTimeNow();
 }
+
+const gd::String incrementalExportFilename = "incremental-export.json";
+
+std::size_t HashOf(const gd::SerializerElement &element) {
+  gd::String json;
+  gd::Serializer::ToJSON(element, json);
+  return std::hash<gd::String>()(json);
+}
+
+/**
+ * Hash what is used to generate the events code of every layout: the global
+ * objects, groups and variables, the external events, the extensions...
+ */
+std::size_t HashProjectCodeInputs(const gd::Project &project) {
+  gd::SerializerElement element;
+  element.AddChild("gdVersion")
+      .SetStringValue(gd::VersionWrapper::FullString());
+  auto &platformExtensionsElement = element.AddChild("platformExtensions");
+  platformExtensionsElement.ConsiderAsArray();
+  for (const auto &extension :
+       gdjs::JsPlatform::Get().GetAllPlatformExtensions()) {
+    platformExtensionsElement.AddChild("").SetStringValue(
+        extension->GetName());
+  }
+
+  project.SerializeObjectsTo(element.AddChild("objects"));
+  project.GetObjectGroups().SerializeTo(element.AddChild("objectsGroups"));
+  project.GetVariables().SerializeTo(element.AddChild("variables"));
+  auto &externalEventsElement = element.AddChild("externalEvents");
+  externalEventsElement.ConsiderAsArrayOf("externalEvents");
+  for (std::size_t i = 0; i < project.GetExternalEventsCount(); ++i) {
+    project.GetExternalEvents(i).SerializeTo(
+        externalEventsElement.AddChild("externalEvents"));
+  }
+  auto &extensionsElement = element.AddChild("eventsFunctionsExtensions");
+  extensionsElement.ConsiderAsArrayOf("eventsFunctionsExtension");
+  for (std::size_t i = 0; i < project.GetEventsFunctionsExtensionsCount();
+       ++i) {
+    project.GetEventsFunctionsExtension(i).SerializeTo(
+        extensionsElement.AddChild("eventsFunctionsExtension"));
+  }
+
+  return HashOf(element);
+}
+
+/**
+ * Hash what is used to generate the events code of a layout: the layout
+ * itself (its instances excepted) and what is shared by all layouts.
+ */
+gd::String HashLayoutCodeInputs(const gd::Layout &layout,
+                                std::size_t projectCodeInputsHash) {
+  gd::SerializerElement element;
+  layout.SerializeTo(element);
+  element.RemoveChild("instances");
+
+  return gd::String::From(projectCodeInputsHash) + "-" +
+         gd::String::From(HashOf(element));
+}
 }  // namespace
 
 namespace gdjs {
@@ -102,38 +165,36 @@ bool ExporterHelper::ExportProjectForPixiPreview(
     const PreviewExportOptions &options) {
   double previousTime = GetTimeNow();
   fs.MkDir(options.exportPath);
-  fs.ClearDir(options.exportPath);
+  if (options.incrementalExport)
+    StartIncrementalExport(options.exportPath, options.includeFileHashes);
+  else
+    fs.ClearDir(options.exportPath);
   std::vector<gd::String> includesFiles;
   std::vector<gd::String> resourcesFiles;
 
-  // TODO Try to remove side effects to avoid the copy
-  // that destroys the AST in cache.
-  gd::Project exportedProject = options.project;
-  const gd::Project &immutableProject = exportedProject;
-
-  if (options.fullLoadingScreen) {
-    // Use project properties fallback to set empty properties
-    if (exportedProject.GetAuthorIds().empty() &&
-        !options.fallbackAuthorId.empty()) {
-      exportedProject.GetAuthorIds().push_back(options.fallbackAuthorId);
-    }
-    if (exportedProject.GetAuthorUsernames().empty() &&
-        !options.fallbackAuthorUsername.empty()) {
-      exportedProject.GetAuthorUsernames().push_back(
-          options.fallbackAuthorUsername);
-    }
-  } else {
-    // Most of the time, we skip the logo and minimum duration so that
-    // the preview start as soon as possible.
-    exportedProject.GetLoadingScreen()
-        .ShowGDevelopLogoDuringLoadingScreen(false)
-        .SetMinDuration(0);
-    exportedProject.GetWatermark().ShowGDevelopWatermark(false);
+  // The project is not copied: the resources (whose filenames are updated)
+  // are copied, and the other changes are done on the exported project data.
+  gd::ResourcesManager exportedResources =
+      options.project.GetResourcesManager();
+  std::unique_ptr<gd::Project> projectWithUpdatedFilenames;
+  if (!gd::ProjectResourcesCopier::CopyAllResourcesTo(options.project,
+                                                      exportedResources,
+                                                      fs,
+                                                      options.exportPath,
+                                                      false,
+                                                      false)) {
+    // Compatibility with old projects referring to files in objects or events:
+    // the filenames must be updated in a copy of the project (*before*
+    // generating events).
+    projectWithUpdatedFilenames =
+        gd::make_unique<gd::Project>(options.project);
+    ExportResources(fs, *projectWithUpdatedFilenames, options.exportPath);
+    exportedResources = projectWithUpdatedFilenames->GetResourcesManager();
   }
-
-  // Export resources (*before* generating events as some resources filenames
-  // may be updated)
-  ExportResources(fs, exportedProject, options.exportPath);
+  gd::Project &exportedProject = projectWithUpdatedFilenames
+                                     ? *projectWithUpdatedFilenames
+                                     : options.project;
+  const gd::Project &immutableProject = exportedProject;
 
   previousTime = LogTimeSpent("Resource export", previousTime);
 
@@ -141,7 +202,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   // Stay compatible with text objects declaring their font as just a filename
   // without a font resource - by manually adding these resources.
   AddDeprecatedFontFilesToFontResources(
-      fs, exportedProject.GetResourcesManager(), options.exportPath);
+      fs, exportedResources, options.exportPath);
   // end of compatibility code
 
   auto usedExtensionsResult =
@@ -173,8 +234,10 @@ bool ExporterHelper::ExportProjectForPixiPreview(
 
   if (!options.projectDataOnlyExport) {
     // Generate events code
+    std::size_t reusedFilesCount = reusedFiles.size();
     if (!ExportEventsCode(immutableProject, codeOutputDir, includesFiles, true))
       return false;
+    std::size_t reusedLayoutsCount = reusedFiles.size() - reusedFilesCount;
 
     // Export source files
     if (!ExportExternalSourceFiles(
@@ -185,7 +248,11 @@ bool ExporterHelper::ExportProjectForPixiPreview(
       return false;
     }
 
-    previousTime = LogTimeSpent("Events code export", previousTime);
+    previousTime = LogTimeSpent(
+        "Events code export (" + gd::String::From(reusedLayoutsCount) + "/" +
+            gd::String::From(immutableProject.GetLayoutsCount()) +
+            " scenes reused)",
+        previousTime);
   }
 
   auto projectUsedResources =
@@ -199,10 +266,16 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                                                           layout);
   }
 
+  gd::SerializerElement projectElement;
+  projectElement.UseArenaAllocation();
+  immutableProject.SerializeTo(projectElement);
+  SerializePreviewProjectChanges(
+      immutableProject, exportedResources, options, projectElement);
+
   // Strip the project (*after* generating events as the events may use stripped
   // things (objects groups...))
-  gd::ProjectStripper::StripProjectForExport(exportedProject);
-  exportedProject.SetFirstLayout(options.layoutName);
+  gd::ProjectStripper::StripSerializedProjectForExport(immutableProject,
+                                                       projectElement);
 
   previousTime = LogTimeSpent("Data stripping", previousTime);
 
@@ -246,7 +319,7 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   }
 
   // Export the project
-  ExportProjectData(fs, exportedProject, codeOutputDir + "/data.js",
+  ExportProjectData(fs, projectElement, codeOutputDir + "/data.js",
                     runtimeGameOptions, projectUsedResources,
                     scenesUsedResources);
   includesFiles.push_back(codeOutputDir + "/data.js");
@@ -254,11 +327,13 @@ bool ExporterHelper::ExportProjectForPixiPreview(
   previousTime = LogTimeSpent("Project data export", previousTime);
 
   // Copy all the dependencies and their source maps
+  std::size_t reusedFilesCount = reusedFiles.size();
   ExportIncludesAndLibs(includesFiles, options.exportPath, true);
   ExportIncludesAndLibs(resourcesFiles, options.exportPath, true);
+  std::size_t reusedIncludesCount = reusedFiles.size() - reusedFilesCount;
 
   // Create the index file
-  if (!ExportPixiIndexFile(exportedProject,
+  if (!ExportPixiIndexFile(immutableProject,
                            gdjsRoot + "/Runtime/index.html",
                            options.exportPath,
                            includesFiles,
@@ -266,7 +341,12 @@ bool ExporterHelper::ExportProjectForPixiPreview(
                            "gdjs.runtimeGameOptions"))
     return false;
 
-  previousTime = LogTimeSpent("Include and libs export", previousTime);
+  if (options.incrementalExport) EndIncrementalExport();
+
+  previousTime = LogTimeSpent(
+      "Include and libs export (" + gd::String::From(reusedIncludesCount) +
+          " files reused)",
+      previousTime);
   return true;
 }
 
@@ -277,22 +357,76 @@ gd::String ExporterHelper::ExportProjectData(
     const gd::SerializerElement &runtimeGameOptions,
     std::set<gd::String> &projectUsedResources,
     std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources) {
-  fs.MkDir(fs.DirNameFrom(filename));
-
   // Save the project to JSON
   gd::SerializerElement rootElement;
   project.SerializeTo(rootElement);
+  return ExportProjectData(fs, rootElement, filename, runtimeGameOptions,
+                           projectUsedResources, scenesUsedResources);
+}
+
+gd::String ExporterHelper::ExportProjectData(
+    gd::AbstractFileSystem &fs,
+    gd::SerializerElement &rootElement,
+    gd::String filename,
+    const gd::SerializerElement &runtimeGameOptions,
+    std::set<gd::String> &projectUsedResources,
+    std::unordered_map<gd::String, std::set<gd::String>> &scenesUsedResources) {
+  fs.MkDir(fs.DirNameFrom(filename));
+
   SerializeUsedResources(rootElement, projectUsedResources, scenesUsedResources);
-  gd::String output =
-      "gdjs.projectData = " + gd::Serializer::ToJSON(rootElement) + ";\n" +
-      "gdjs.runtimeGameOptions = " +
-      gd::Serializer::ToJSON(runtimeGameOptions) + ";\n";
+  // The JSON is written directly in the output, to avoid holding
+  // intermediate copies of the whole project data.
+  gd::String output = "gdjs.projectData = ";
+  gd::Serializer::ToJSON(rootElement, output);
+  output += ";\ngdjs.runtimeGameOptions = ";
+  gd::Serializer::ToJSON(runtimeGameOptions, output);
+  output += ";\n";
 
   if (!fs.WriteToFile(filename, output)) return "Unable to write " + filename;
 
   return "";
 }
 
+void ExporterHelper::SerializePreviewProjectChanges(
+    const gd::Project &project,
+    const gd::ResourcesManager &exportedResources,
+    const PreviewExportOptions &options,
+    gd::SerializerElement &projectElement) {
+  gd::SerializerElement &propertiesElement =
+      projectElement.GetChild("properties");
+  if (options.fullLoadingScreen) {
+    // Use project properties fallback to set empty properties
+    if (project.GetAuthorIds().empty() && !options.fallbackAuthorId.empty()) {
+      propertiesElement.GetChild("authorIds")
+          .AddChild("")
+          .SetStringValue(options.fallbackAuthorId);
+    }
+    if (project.GetAuthorUsernames().empty() &&
+        !options.fallbackAuthorUsername.empty()) {
+      propertiesElement.GetChild("authorUsernames")
+          .AddChild("")
+          .SetStringValue(options.fallbackAuthorUsername);
+    }
+  } else {
+    // Most of the time, we skip the logo and minimum duration so that
+    // the preview start as soon as possible.
+    gd::LoadingScreen loadingScreen = project.GetLoadingScreen();
+    loadingScreen.ShowGDevelopLogoDuringLoadingScreen(false).SetMinDuration(0);
+    loadingScreen.SerializeTo(propertiesElement.GetChild("loadingScreen"));
+    gd::Watermark watermark = project.GetWatermark();
+    watermark.ShowGDevelopWatermark(false);
+    watermark.SerializeTo(propertiesElement.GetChild("watermark"));
+  }
+
+  projectElement.SetAttribute("firstLayout", options.layoutName);
+
+  // Resources filenames were updated for the export.
+  gd::SerializerElement &resourcesElement =
+      projectElement.GetChild("resources");
+  resourcesElement = gd::SerializerElement();
+  exportedResources.SerializeTo(resourcesElement);
+}
+
 void ExporterHelper::SerializeUsedResources(
     gd::SerializerElement &rootElement,
     std::set<gd::String> &projectUsedResources,
@@ -857,18 +991,74 @@ bool ExporterHelper::ExportEventsCode(const gd::Project &project,
                                       bool exportForPreview) {
   fs.MkDir(outputDir);
 
+  bool incrementalExport = !incrementalExportDir.empty();
+  std::size_t projectCodeInputsHash =
+      incrementalExport ? HashProjectCodeInputs(project) : 0;
+
+  // Reuse the code of the previous export for the layouts that did not change.
+  std::vector<bool> reusedLayouts(project.GetLayoutsCount(), false);
+  std::vector<std::size_t> generatedLayoutIndices;
   for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
-    std::set<gd::String> eventsIncludes;
-    const gd::Layout &layout = project.GetLayout(i);
+    gd::String exportedFilename = fs.FileNameFrom(
+        outputDir + "/" + "code" + gd::String::From(i) + ".js");
+    gd::String hash = incrementalExport
+                          ? HashLayoutCodeInputs(project.GetLayout(i),
+                                                 projectCodeInputsHash)
+                          : "";
+    if (ReuseExportedFile(exportedFilename, hash))
+      reusedLayouts[i] = true;
+    else
+      generatedLayoutIndices.push_back(i);
+  }
+
+  // Generate the code of the layouts in parallel: the project is only read,
+  // the events being copied before being preprocessed. What is built on first
+  // use is built before.
+  project.GetCurrentPlatform().GetMetadataIndex();
+  gd::SceneNameMangler::Get();
+  EventsCodeNameMangler::Get();
+  gd::ExpressionNodeCache::Get();
+  std::vector<gd::String> generatedCodes(generatedLayoutIndices.size());
+  std::vector<std::set<gd::String>> generatedIncludes(
+      generatedLayoutIndices.size());
+  gd::ParallelFor(generatedLayoutIndices.size(), [&](std::size_t i) {
     LayoutCodeGenerator layoutCodeGenerator(project);
-    gd::String eventsOutput = layoutCodeGenerator.GenerateLayoutCompleteCode(
-        layout, eventsIncludes, !exportForPreview);
+    generatedCodes[i] = layoutCodeGenerator.GenerateLayoutCompleteCode(
+        project.GetLayout(generatedLayoutIndices[i]),
+        generatedIncludes[i],
+        !exportForPreview);
+  });
+
+  // Write the files and merge the includes in the order of the layouts, so
+  // that the export does not depend on the threads.
+  std::size_t generatedIndex = 0;
+  for (std::size_t i = 0; i < project.GetLayoutsCount(); ++i) {
     gd::String filename =
         outputDir + "/" + "code" + gd::String::From(i) + ".js";
+    gd::String exportedFilename = fs.FileNameFrom(filename);
+
+    if (reusedLayouts[i]) {
+      const auto &previousIncludes =
+          previousExportedFiles[exportedFilename].includes;
+      exportedFiles[exportedFilename].includes = previousIncludes;
+      for (auto &include : previousIncludes)
+        InsertUnique(includesFiles, include);
+
+      InsertUnique(includesFiles, filename);
+      continue;
+    }
+
+    const auto &eventsIncludes = generatedIncludes[generatedIndex];
+    const gd::String &eventsOutput = generatedCodes[generatedIndex];
+    generatedIndex++;
 
     // Export the code
     if (fs.WriteToFile(filename, eventsOutput)) {
       for (auto &include : eventsIncludes) InsertUnique(includesFiles, include);
+      if (incrementalExport) {
+        exportedFiles[exportedFilename].includes.assign(eventsIncludes.begin(),
+                                                        eventsIncludes.end());
+      }
 
       InsertUnique(includesFiles, filename);
     } else {
@@ -948,6 +1138,13 @@ bool ExporterHelper::ExportIncludesAndLibs(
     bool exportSourceMaps) {
   for (auto &include : includesFiles) {
     if (!fs.IsAbsolute(include)) {
+      // Runtime files are only copied when they changed since the previous
+      // export, if any.
+      auto hashIt = includeFileHashes.find(include);
+      if (hashIt != includeFileHashes.end() &&
+          ReuseExportedFile(include, gd::String::From(hashIt->second)))
+        continue;
+
       // By convention, an include file that is relative is relative to
       // the "<GDJS Root>/Runtime" folder, and will have the same relative
       // path when exported.
@@ -970,7 +1167,9 @@ bool ExporterHelper::ExportIncludesAndLibs(
     } else {
       // Note: all the code generated from events are generated in another
       // folder and fall in this case:
-      if (fs.FileExists(include)) {
+      if (reusedFiles.count(fs.FileNameFrom(include))) {
+        // The file was kept from the previous export.
+      } else if (fs.FileExists(include)) {
         fs.CopyFile(include, exportDir + "/" + fs.FileNameFrom(include));
       } else {
         std::cout << "Could not find include file " << include << std::endl;
@@ -981,6 +1180,72 @@ bool ExporterHelper::ExportIncludesAndLibs(
   return true;
 }
 
+void ExporterHelper::StartIncrementalExport(
+    const gd::String &exportDir,
+    const std::map<gd::String, int> &includeFileHashes_) {
+  incrementalExportDir = exportDir;
+  includeFileHashes = includeFileHashes_;
+  previousExportedFiles.clear();
+  exportedFiles.clear();
+  reusedFiles.clear();
+
+  gd::String filename = exportDir + "/" + incrementalExportFilename;
+  if (!fs.FileExists(filename)) return;
+
+  gd::SerializerElement rootElement =
+      gd::Serializer::FromJSON(fs.ReadFile(filename));
+  auto &filesElement = rootElement.GetChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (std::size_t i = 0; i < filesElement.GetChildrenCount(); ++i) {
+    auto &fileElement = filesElement.GetChild(i);
+    auto &exportedFile =
+        previousExportedFiles[fileElement.GetStringAttribute("path")];
+    exportedFile.hash = fileElement.GetStringAttribute("hash");
+
+    auto &includesElement = fileElement.GetChild("includes");
+    includesElement.ConsiderAsArrayOf("include");
+    for (std::size_t j = 0; j < includesElement.GetChildrenCount(); ++j) {
+      exportedFile.includes.push_back(
+          includesElement.GetChild(j).GetStringValue());
+    }
+  }
+}
+
+void ExporterHelper::EndIncrementalExport() {
+  gd::SerializerElement rootElement;
+  auto &filesElement = rootElement.AddChild("files");
+  filesElement.ConsiderAsArrayOf("file");
+  for (const auto &it : exportedFiles) {
+    auto &fileElement = filesElement.AddChild("file");
+    fileElement.SetStringAttribute("path", it.first);
+    fileElement.SetStringAttribute("hash", it.second.hash);
+
+    auto &includesElement = fileElement.AddChild("includes");
+    includesElement.ConsiderAsArrayOf("include");
+    for (const auto &include : it.second.includes)
+      includesElement.AddChild("include").SetStringValue(include);
+  }
+
+  gd::String filename = incrementalExportDir + "/" + incrementalExportFilename;
+  if (!fs.WriteToFile(filename, gd::Serializer::ToJSON(rootElement)))
+    gd::LogWarning("Unable to write " + filename);
+}
+
+bool ExporterHelper::ReuseExportedFile(const gd::String &exportedFilename,
+                                       const gd::String &hash) {
+  if (incrementalExportDir.empty() || hash.empty()) return false;
+
+  exportedFiles[exportedFilename].hash = hash;
+  auto previousIt = previousExportedFiles.find(exportedFilename);
+  if (previousIt == previousExportedFiles.end() ||
+      previousIt->second.hash != hash ||
+      !fs.FileExists(incrementalExportDir + "/" + exportedFilename))
+    return false;
+
+  reusedFiles.insert(exportedFilename);
+  return true;
+}
+
 void ExporterHelper::ExportResources(gd::AbstractFileSystem &fs,
                                      gd::Project &project,
                                      gd::String exportDir) {
@@ -42,7 +42,8 @@ struct PreviewExportOptions {
         nonRuntimeScriptsCacheBurst(0),
         fallbackAuthorId(""),
         fallbackAuthorUsername(""),
-        allowAuthenticationUsingIframeForPreview(false){};
+        allowAuthenticationUsingIframeForPreview(false),
+        incrementalExport(false){};
 
   /**
    * \brief Set the address of the debugger server that the game should reach
@@ -176,6 +177,19 @@ struct PreviewExportOptions {
     return *this;
   }
 
+  /**
+   * \brief Set if the export should reuse the files of the previous preview
+   * exported to the same path (false by default).
+   *
+   * The events code of the scenes that did not change is not generated again,
+   * and the runtime files that did not change (according to the hashes set
+   * with SetIncludeFileHash) are not copied again.
+   */
+  PreviewExportOptions &SetIncrementalExport(bool enable) {
+    incrementalExport = enable;
+    return *this;
+  }
+
   gd::Project &project;
   gd::String exportPath;
   gd::String websocketDebuggerServerAddress;
@@ -193,6 +207,7 @@ struct PreviewExportOptions {
   gd::String electronRemoteRequirePath;
   gd::String gdevelopResourceToken;
   bool allowAuthenticationUsingIframeForPreview;
+  bool incrementalExport;
 };
 
 /**
@@ -272,6 +287,19 @@ class ExporterHelper {
                     std::set<gd::String> &projectUsedResources,
                     std::unordered_map<gd::String, std::set<gd::String>> &layersUsedResources);
 
+  /**
+   * \brief Export the serialization of a project to JSON.
+   *
+   * \see ExporterHelper::ExportProjectData
+   */
+  static gd::String
+  ExportProjectData(gd::AbstractFileSystem &fs,
+                    gd::SerializerElement &projectElement,
+                    gd::String filename,
+                    const gd::SerializerElement &runtimeGameOptions,
+                    std::set<gd::String> &projectUsedResources,
+                    std::unordered_map<gd::String, std::set<gd::String>> &layersUsedResources);
+
   /**
    * \brief Copy all the resources of the project to to the export directory,
    * updating the resources filenames.
@@ -311,6 +339,9 @@ class ExporterHelper {
    * \param exportDir The directory where the files must be copied.
    * \param exportSourceMaps Should the source maps be copied? Should be true on
    * previews only.
+   *
+   * \note For an incremental export, the files that were already exported
+   * and did not change are not copied again.
    */
   bool ExportIncludesAndLibs(const std::vector<gd::String> &includesFiles,
                              gd::String exportDir,
@@ -324,6 +355,13 @@ class ExporterHelper {
    * outputDir The directory where the events code must be generated. \param
    * includesFiles A reference to a vector that will be filled with JS files to
    * be exported along with the project. ( including "codeX.js" files ).
+   *
+   * The code of the layouts is generated in parallel on native builds (see
+   * gd::ParallelFor), the files and includes being output in the order of
+   * the layouts.
+   *
+   * \note For an incremental export, the code of the layouts that did not
+   * change since the previous export is not generated again.
    */
   bool ExportEventsCode(const gd::Project &project,
                         gd::String outputDir,
@@ -451,6 +489,10 @@ class ExporterHelper {
    * \note The preview is not launched, it is the caller responsibility to open
    * a browser pointing to the preview.
    *
+   * The project is not copied nor modified, except for old projects referring
+   * to files (instead of resources) in objects or events, which are copied to
+   * update these filenames.
+   *
    * \param options The options to generate the preview.
    */
   bool ExportProjectForPixiPreview(const PreviewExportOptions &options);
@@ -486,10 +528,58 @@ class ExporterHelper {
                              ///< be then copied to the final output directory.
 
 private:
+  /**
+   * \brief Apply the changes done for a preview (loading screen, first
+   * layout, resources filenames...) to the serialization of the project, so
+   * that the project is not modified.
+   */
+  static void SerializePreviewProjectChanges(
+      const gd::Project &project,
+      const gd::ResourcesManager &exportedResources,
+      const PreviewExportOptions &options,
+      gd::SerializerElement &projectElement);
+
   static void SerializeUsedResources(
       gd::SerializerElement &rootElement,
       std::set<gd::String> &projectUsedResources,
       std::unordered_map<gd::String, std::set<gd::String>> &layersUsedResources);
+
+  /**
+   * \brief A file written by an incremental export.
+   */
+  struct ExportedFile {
+    gd::String hash;  ///< The hash of what was used to create the file.
+    std::vector<gd::String> includes;  ///< Files included by generated code.
+  };
+
+  /**
+   * \brief Start an incremental export in the given directory, reading
+   * the files written by the previous export.
+   */
+  void StartIncrementalExport(const gd::String &exportDir,
+                              const std::map<gd::String, int> &includeFileHashes);
+
+  /**
+   * \brief Save the files written by the incremental export, for the next one.
+   */
+  void EndIncrementalExport();
+
+  /**
+   * \brief Register that a file is exported, and return true if the file
+   * written by the previous export, having the same hash, can be reused.
+   *
+   * \param exportedFilename The file, relative to the export directory.
+   * \param hash The hash of what is used to create the file. If empty, the
+   * file can't be reused.
+   */
+  bool ReuseExportedFile(const gd::String &exportedFilename,
+                         const gd::String &hash);
+
+  gd::String incrementalExportDir;  ///< Set for incremental exports only.
+  std::map<gd::String, int> includeFileHashes;
+  std::map<gd::String, ExportedFile> previousExportedFiles;
+  std::map<gd::String, ExportedFile> exportedFiles;
+  std::set<gd::String> reusedFiles;  ///< Files kept from the previous export.
 };
 
 }  // namespace gdjs
@@ -45,7 +45,8 @@ ObjectJsImplementation::GetProperties() const {
         if (!self.hasOwnProperty('getProperties'))
           throw 'getProperties is not defined on a ObjectJsImplementation.';
 
-        var objectContent = JSON.parse(UTF8ToString($1));
+        var objectContent = Module['Serializer']['toJSObject'](
+            wrapPointer($1, Module['SerializerElement']));
         var newProperties = self['getProperties'](objectContent);
         if (!newProperties)
           throw 'getProperties returned nothing in a gd::ObjectJsImplementation.';
@@ -53,7 +54,7 @@ ObjectJsImplementation::GetProperties() const {
         return getPointer(newProperties);
       },
       (int)this,
-      jsonContent.c_str());
+      (int)&content);
 
   copiedProperties = *jsCreatedProperties;
   delete jsCreatedProperties;
@@ -61,18 +62,20 @@ ObjectJsImplementation::GetProperties() const {
 }
 bool ObjectJsImplementation::UpdateProperty(const gd::String& arg0,
                                             const gd::String& arg1) {
-  jsonContent = (const char*)EM_ASM_INT(
+  EM_ASM_INT(
       {
         var self = Module['getCache'](Module['ObjectJsImplementation'])[$0];
         if (!self.hasOwnProperty('updateProperty'))
           throw 'updateProperty is not defined on a ObjectJsImplementation.';
-        var objectContent = JSON.parse(UTF8ToString($1));
+        var objectContent = Module['Serializer']['toJSObject'](
+            wrapPointer($1, Module['SerializerElement']));
         self['updateProperty'](
             objectContent, UTF8ToString($2), UTF8ToString($3));
-        return ensureString(JSON.stringify(objectContent));
+        Module['Serializer']['fromJSObject'](
+            objectContent, wrapPointer($1, Module['SerializerElement']));
       },
       (int)this,
-      jsonContent.c_str(),
+      (int)&content,
       arg0.c_str(),
       arg1.c_str());
 
@@ -93,7 +96,8 @@ ObjectJsImplementation::GetInitialInstanceProperties(
         if (!self.hasOwnProperty('getInitialInstanceProperties'))
           throw 'getInitialInstanceProperties is not defined on a ObjectJsImplementation.';
 
-        var objectContent = JSON.parse(UTF8ToString($1));
+        var objectContent = Module['Serializer']['toJSObject'](
+            wrapPointer($1, Module['SerializerElement']));
         var newProperties = self['getInitialInstanceProperties'](
             objectContent,
             wrapPointer($2, Module['InitialInstance']),
@@ -105,7 +109,7 @@ ObjectJsImplementation::GetInitialInstanceProperties(
         return getPointer(newProperties);
       },
       (int)this,
-      jsonContent.c_str(),
+      (int)&content,
       (int)&instance,
       (int)&project,
       (int)&scene);
@@ -126,7 +130,8 @@ bool ObjectJsImplementation::UpdateInitialInstanceProperty(
         var self = Module['getCache'](Module['ObjectJsImplementation'])[$0];
         if (!self.hasOwnProperty('updateInitialInstanceProperty'))
           throw 'updateInitialInstanceProperty is not defined on a ObjectJsImplementation.';
-        var objectContent = JSON.parse(UTF8ToString($1));
+        var objectContent = Module['Serializer']['toJSObject'](
+            wrapPointer($1, Module['SerializerElement']));
         return self['updateInitialInstanceProperty'](
             objectContent,
             wrapPointer($2, Module['InitialInstance']),
@@ -136,7 +141,7 @@ bool ObjectJsImplementation::UpdateInitialInstanceProperty(
             wrapPointer($6, Module['Layout']));
       },
       (int)this,
-      jsonContent.c_str(),
+      (int)&content,
       (int)&instance,
       name.c_str(),
       value.c_str(),
@@ -145,11 +150,11 @@ bool ObjectJsImplementation::UpdateInitialInstanceProperty(
 }
 
 void ObjectJsImplementation::DoSerializeTo(SerializerElement& element) const {
-  element.AddChild("content") = gd::Serializer::FromJSON(jsonContent);
+  element.AddChild("content") = content;
 }
 void ObjectJsImplementation::DoUnserializeFrom(Project& project,
                                                const SerializerElement& element) {
-  jsonContent = gd::Serializer::ToJSON(element.GetChild("content"));
+  content = element.GetChild("content");
 }
 
 void ObjectJsImplementation::__destroy__() {  // Useless?
@@ -9,15 +9,18 @@
 using namespace gd;
 
 /**
- * \brief A gd::Object that stores its content in JSON and forward the
- * properties related functions to Javascript with Emscripten.
+ * \brief A gd::Object that stores its content in a gd::SerializerElement and
+ * forward the properties related functions to Javascript with Emscripten.
+ *
+ * The content is given to the JavaScript functions as a JS object, converted
+ * with gd.Serializer.toJSObject/fromJSObject (which don't involve JSON).
  *
  * It also implements "ExposeResources" to expose the properties of type
  * "resource".
  */
 class ObjectJsImplementation : public gd::ObjectConfiguration {
  public:
-  ObjectJsImplementation() : jsonContent("{}") {}
+  ObjectJsImplementation() {}
   std::unique_ptr<gd::ObjectConfiguration> Clone() const override;
 
   std::map<gd::String, gd::PropertyDescriptor> GetProperties() const override;
@@ -35,16 +38,35 @@ class ObjectJsImplementation : public gd::ObjectConfiguration {
 
   void __destroy__();
 
-  const gd::String& GetRawJSONContent() const { return jsonContent; };
+  /**
+   * \brief Return the content of the object, converted to JSON.
+   */
+  gd::String GetRawJSONContent() const {
+    return gd::Serializer::ToJSON(content);
+  };
+
+  /**
+   * \brief Replace the content of the object by the given JSON.
+   */
   ObjectJsImplementation& SetRawJSONContent(const gd::String& newContent) {
-    jsonContent = newContent;
+    content = gd::Serializer::FromJSON(newContent);
     return *this;
   };
 
+  /**
+   * \brief Return the content of the object.
+   */
+  gd::SerializerElement& GetContent() { return content; };
+
+  /**
+   * \brief Return the content of the object.
+   */
+  const gd::SerializerElement& GetContent() const { return content; };
+
   void ExposeResources(gd::ArbitraryResourceWorker& worker) override;
 
  protected:
   void DoSerializeTo(SerializerElement& arg0) const override;
   void DoUnserializeFrom(Project& arg0, const SerializerElement& arg1) override;
-  gd::String jsonContent;
+  gd::SerializerElement content;
 };
@@ -84,6 +84,7 @@
 #include <GDCore/Project/Variable.h>
 #include <GDCore/Project/VariablesContainer.h>
 #include <GDCore/Project/VariablesContainersList.h>
+#include <GDCore/Serialization/BinarySerializer.h>
 #include <GDCore/Serialization/Serializer.h>
 #include <GDCore/Serialization/SerializerElement.h>
 #include <GDCore/IDE/ObjectAssetSerializer.h>
@@ -530,6 +531,17 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 
 #define WRAPPED_at(a) at(a).get()
 
+#define WRAPPED_ParseEditedExpression(expression,                    \
+                                      previousRootNode,              \
+                                      editStartPosition,             \
+                                      editPreviousEndPosition,       \
+                                      editEndPosition)               \
+  ParseEditedExpression(expression,                                  \
+                        std::move(previousRootNode),                 \
+                        editStartPosition,                           \
+                        editPreviousEndPosition,                     \
+                        editEndPosition)
+
 #define MAP_getOrCreate(key) operator[](key)
 #define MAP_get(key) find(key)->second
 #define MAP_set(key, value) [key] = value
@@ -689,6 +701,7 @@ typedef ExtensionAndMetadata<ExpressionMetadata> ExtensionAndExpressionMetadata;
 
 #define STATIC_GetNamespaceSeparator GetNamespaceSeparator
 #define STATIC_GetBehaviorFullType GetBehaviorFullType
+#define STATIC_IndexEventsSymbols IndexEventsSymbols
 #define STATIC_ApplyRefactoringForVariablesContainer \
   ApplyRefactoringForVariablesContainer
 #define STATIC_ComputeChangesetForVariablesContainer \
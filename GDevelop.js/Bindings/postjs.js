@@ -177,96 +177,287 @@ var adaptNamingConventions = function (gd) {
     return arr;
   };
 
-  // Add gd.Serializer.fromJSObject which is much faster than manually parsing
-  // JSON with gd.Serializer.fromJSON.
-  const elementFromJSObject = function (object, element) {
+  // Add gd.Serializer.fromJSObject and gd.Serializer.toJSObject, which are
+  // much faster than manually parsing JSON with gd.Serializer.fromJSON.
+  // Elements are transferred at once, in the binary format of
+  // gd::BinarySerializer, by reading/writing a gd.BinarySerializerBuffer
+  // directly in the memory of the module (instead of calling the bindings
+  // for each element and value).
+  const binarySerializerMagic = [0x47, 0x44, 0x53, 0x42]; // "GDSB"
+  const binarySerializerVersion = 1;
+  const binarySerializerValueType = {
+    Undefined: 0,
+    Boolean: 1,
+    Int: 2,
+    Double: 3,
+    String: 4,
+    Unknown: 5,
+  };
+  const binarySerializerValueTypeMask = 0x07;
+  const binarySerializerArrayFlag = 0x10;
+  const textEncoder = new TextEncoder();
+  const textDecoder = new TextDecoder();
+
+  /** A growable buffer to write the binary format. */
+  class BinaryWriter {
+    constructor() {
+      this.bytes = new Uint8Array(1024);
+      this.view = new DataView(this.bytes.buffer);
+      this.size = 0;
+    }
+
+    reserve(additionalSize) {
+      if (this.size + additionalSize <= this.bytes.length) return;
+
+      let capacity = this.bytes.length * 2;
+      while (capacity < this.size + additionalSize) capacity *= 2;
+      const bytes = new Uint8Array(capacity);
+      bytes.set(this.bytes.subarray(0, this.size));
+      this.bytes = bytes;
+      this.view = new DataView(bytes.buffer);
+    }
+
+    writeUInt8(value) {
+      this.reserve(1);
+      this.bytes[this.size++] = value;
+    }
+
+    writeUInt32(value) {
+      this.reserve(4);
+      this.view.setUint32(this.size, value, true);
+      this.size += 4;
+    }
+
+    patchUInt32(position, value) {
+      this.view.setUint32(position, value, true);
+    }
+
+    writeDouble(value) {
+      this.reserve(8);
+      this.view.setFloat64(this.size, value, true);
+      this.size += 8;
+    }
+
+    writeString(value) {
+      // An UTF8 character is at most 3 bytes for each UTF16 code unit.
+      this.reserve(4 + value.length * 3);
+      const { written } = textEncoder.encodeInto(
+        value,
+        this.bytes.subarray(this.size + 4)
+      );
+      this.writeUInt32(written);
+      this.size += written;
+    }
+  }
+
+  const writeElementFromJSObject = function (writer, keyIndices, object) {
+    const getKeyIndex = function (key) {
+      let index = keyIndices.get(key);
+      if (index === undefined) {
+        index = keyIndices.size;
+        keyIndices.set(key, index);
+      }
+      return index;
+    };
+
     if (typeof object === 'number') {
-      element.setDoubleValue(object);
+      writer.writeUInt8(binarySerializerValueType.Double);
+      writer.writeDouble(object);
     } else if (typeof object === 'string') {
-      element.setStringValue(object);
+      writer.writeUInt8(binarySerializerValueType.String);
+      writer.writeString(object);
     } else if (typeof object === 'boolean') {
-      element.setBoolValue(object);
+      writer.writeUInt8(binarySerializerValueType.Boolean);
+      writer.writeUInt8(object ? 1 : 0);
     } else if (Array.isArray(object)) {
-      element.considerAsArray();
-      for (var i = 0; i < object.length; ++i) {
-        var item = element.addChild('');
-        elementFromJSObject(object[i], item);
+      writer.writeUInt8(
+        binarySerializerValueType.Undefined | binarySerializerArrayFlag
+      );
+      const childNameIndex = getKeyIndex('');
+      writer.writeUInt32(childNameIndex);
+      writer.writeUInt32(0); // No attributes.
+      writer.writeUInt32(object.length);
+      for (let i = 0; i < object.length; ++i) {
+        writer.writeUInt32(childNameIndex);
+        const childSizePosition = writer.size;
+        writer.writeUInt32(0);
+        writeElementFromJSObject(writer, keyIndices, object[i]);
+        writer.patchUInt32(
+          childSizePosition,
+          writer.size - childSizePosition - 4
+        );
       }
-    } else if (typeof object === 'object') {
-      for (var childName in object) {
+      return;
+    } else if (object !== null && typeof object === 'object') {
+      writer.writeUInt8(binarySerializerValueType.Undefined);
+      writer.writeUInt32(0); // No attributes.
+      const childrenCountPosition = writer.size;
+      writer.writeUInt32(0);
+      let childrenCount = 0;
+      for (const childName in object) {
         if (object.hasOwnProperty(childName)) {
-          var child = element.addChild(childName);
-          elementFromJSObject(object[childName], child);
+          writer.writeUInt32(getKeyIndex(childName));
+          const childSizePosition = writer.size;
+          writer.writeUInt32(0);
+          writeElementFromJSObject(writer, keyIndices, object[childName]);
+          writer.patchUInt32(
+            childSizePosition,
+            writer.size - childSizePosition - 4
+          );
+          childrenCount++;
         }
       }
+      writer.patchUInt32(childrenCountPosition, childrenCount);
+      return;
+    } else {
+      writer.writeUInt8(binarySerializerValueType.Undefined);
     }
-  };
 
-  gd.Serializer.fromJSObject = function (object) {
-    var element = new gd.SerializerElement();
-    elementFromJSObject(object, element);
+    // Values (and empty elements) have no attributes and no children.
+    writer.writeUInt32(0);
+    writer.writeUInt32(0);
+  };
 
-    return element;
+  // If an element is given, its content is replaced (instead of creating a
+  // new element).
+  gd.Serializer.fromJSObject = function (object, element) {
+    // Write the root element first, to know the names used by the elements,
+    // then the header with the table of these names.
+    const elementWriter = new BinaryWriter();
+    const keyIndices = new Map();
+    writeElementFromJSObject(elementWriter, keyIndices, object);
+
+    const headerWriter = new BinaryWriter();
+    binarySerializerMagic.forEach((byte) => headerWriter.writeUInt8(byte));
+    headerWriter.writeUInt32(binarySerializerVersion);
+    headerWriter.writeUInt32(keyIndices.size);
+    keyIndices.forEach((index, key) => headerWriter.writeString(key));
+
+    const buffer = new gd.BinarySerializerBuffer();
+    buffer.resize(headerWriter.size + elementWriter.size);
+    // Get the memory after resizing the buffer, as it can have grown.
+    const address = buffer.getDataAddress();
+    HEAPU8.set(headerWriter.bytes.subarray(0, headerWriter.size), address);
+    HEAPU8.set(
+      elementWriter.bytes.subarray(0, elementWriter.size),
+      address + headerWriter.size
+    );
+
+    const outputElement = element || new gd.SerializerElement();
+    buffer.unserializeTo(outputElement);
+    buffer.delete();
+    return outputElement;
   };
 
-  const valueToJSObject = function (serializerValue) {
-    // TODO: use getRaw to avoid conversions
-    if (serializerValue.isBoolean()) return serializerValue.getBool();
-    else if (serializerValue.isDouble()) return serializerValue.getDouble();
-    else if (serializerValue.isInt()) return serializerValue.getInt();
-    else if (serializerValue.isString()) {
-      return serializerValue.getRawString();
+  /** Read the binary format from the memory of the module. */
+  class BinaryReader {
+    constructor(bytes) {
+      this.bytes = bytes;
+      this.view = new DataView(bytes.buffer, bytes.byteOffset, bytes.length);
+      this.position = 0;
+      this.keys = [];
     }
 
-    return null;
-  };
+    readUInt8() {
+      return this.bytes[this.position++];
+    }
 
-  gd.Serializer.toJSObject = function (element) {
-    if (!element.isValueUndefined()) {
-      return valueToJSObject(element.getValue());
-    } else if (element.consideredAsArray()) {
-      const array = [];
-
-      const children = element.getAllChildren();
-      const childrenCount = children.size();
-      for (let i = 0; i < childrenCount; ++i) {
-        // TODO: double check usage of shared_ptr
-        const sharedPtrSerializerElement = children.getSharedPtrSerializerElement(
-          i
-        );
-        const serializerElement = sharedPtrSerializerElement.get();
-        array.push(gd.Serializer.toJSObject(serializerElement));
-        sharedPtrSerializerElement.reset();
-      }
+    readUInt32() {
+      const value = this.view.getUint32(this.position, true);
+      this.position += 4;
+      return value;
+    }
 
-      return array;
-    } else {
-      const object = {};
+    readInt32() {
+      const value = this.view.getInt32(this.position, true);
+      this.position += 4;
+      return value;
+    }
+
+    readDouble() {
+      const value = this.view.getFloat64(this.position, true);
+      this.position += 8;
+      return value;
+    }
 
-      const attributes = element.getAllAttributes();
-      const attributeNames = attributes.keys();
+    readString() {
+      const size = this.readUInt32();
+      const value = textDecoder.decode(
+        this.bytes.subarray(this.position, this.position + size)
+      );
+      this.position += size;
+      return value;
+    }
 
-      for (let i = 0; i < attributeNames.size(); ++i) {
-        const name = attributeNames.at(i);
-        const serializerValue = attributes.get(name);
-        object[name] = valueToJSObject(element.getValue());
+    readValue(valueType) {
+      if (valueType === binarySerializerValueType.Boolean)
+        return this.readUInt8() !== 0;
+      else if (valueType === binarySerializerValueType.Int)
+        return this.readInt32();
+      else if (valueType === binarySerializerValueType.Double)
+        return this.readDouble();
+      else if (valueType === binarySerializerValueType.String)
+        return this.readString();
+      else if (valueType === binarySerializerValueType.Unknown) {
+        this.readString();
+        return null;
       }
 
-      const children = element.getAllChildren();
-      const childrenCount = children.size();
-      for (let i = 0; i < childrenCount; ++i) {
-        // TODO: double check usage of shared_ptr
-        const name = children.getString(i);
-        const sharedPtrSerializerElement = children.getSharedPtrSerializerElement(
-          i
-        );
-        const serializerElement = sharedPtrSerializerElement.get();
-        object[name] = gd.Serializer.toJSObject(serializerElement);
-        sharedPtrSerializerElement.reset();
+      return null;
+    }
+  }
+
+  const readJSObject = function (reader) {
+    const flags = reader.readUInt8();
+    const valueType = flags & binarySerializerValueTypeMask;
+    const value =
+      valueType !== binarySerializerValueType.Undefined
+        ? reader.readValue(valueType)
+        : undefined;
+    const isArray = (flags & binarySerializerArrayFlag) !== 0;
+    if (isArray) reader.readUInt32(); // Name of the children.
+
+    const object = {};
+    const attributesCount = reader.readUInt32();
+    for (let i = 0; i < attributesCount; ++i) {
+      const name = reader.keys[reader.readUInt32()];
+      object[name] = reader.readValue(reader.readUInt8());
+    }
+
+    const array = [];
+    const childrenCount = reader.readUInt32();
+    for (let i = 0; i < childrenCount; ++i) {
+      const name = reader.keys[reader.readUInt32()];
+      const childSize = reader.readUInt32();
+      if (value !== undefined) {
+        // Children of an element with a value are not returned.
+        reader.position += childSize;
+      } else if (isArray) {
+        array.push(readJSObject(reader));
+      } else {
+        object[name] = readJSObject(reader);
       }
-      return object;
     }
-    return null;
+
+    if (value !== undefined) return value;
+    return isArray ? array : object;
+  };
+
+  gd.Serializer.toJSObject = function (element) {
+    const buffer = new gd.BinarySerializerBuffer();
+    buffer.serialize(element);
+    const address = buffer.getDataAddress();
+    const reader = new BinaryReader(
+      HEAPU8.subarray(address, address + buffer.getSize())
+    );
+
+    reader.position = 8; // Magic and version.
+    const keysCount = reader.readUInt32();
+    for (let i = 0; i < keysCount; ++i) reader.keys.push(reader.readString());
+
+    const object = readJSObject(reader);
+    buffer.delete();
+    return object;
   };
 
   //Preserve backward compatibility with some alias for methods:
@@ -2278,6 +2278,27 @@ describe('libGD.js', function () {
         );
       }
     });
+
+    it('stores the content of a gd.ObjectJsImplementation as an element', function () {
+      const object = createSampleObjectJsImplementation();
+      object.updateProperty('My first property', 'updated value');
+
+      const content = gd.asObjectJsImplementation(object).getContent();
+      expect(content.getChild('property1').getStringValue()).toBe(
+        'updated value'
+      );
+      expect(content.getChild('property2').getBoolValue()).toBe(true);
+
+      const element = new gd.SerializerElement();
+      object.serializeTo(element);
+      expect(
+        gd.Serializer.toJSObject(element.getChild('content'))
+      ).toEqual({ property1: 'updated value', property2: true });
+      expect(
+        JSON.parse(gd.asObjectJsImplementation(object).getRawJSONContent())
+      ).toEqual({ property1: 'updated value', property2: true });
+      element.delete();
+    });
   });
 
   describe('gd.ObjectGroupsContainer', function () {
@@ -2772,6 +2793,31 @@ describe('libGD.js', function () {
       list.delete();
     });
 
+    it('can index the symbols used by its events', function () {
+      let list = new gd.EventsList();
+      let event = gd.asStandardEvent(
+        list.insertEvent(new gd.StandardEvent(), 0)
+      );
+      let action = new gd.Instruction();
+      action.setType('SetCameraCenterX');
+      action.setParametersCount(4);
+      action.setParameter(3, '"My layer"');
+      event.getActions().insert(action, 0);
+      action.delete();
+
+      expect(list.hasSymbolsIndex()).toBe(false);
+      expect(list.mayUseSymbol('My other layer')).toBe(true);
+
+      list.indexSymbols();
+      expect(list.hasSymbolsIndex()).toBe(true);
+      expect(list.mayUseSymbol('My layer')).toBe(true);
+      expect(list.mayUseSymbol('My other layer')).toBe(false);
+
+      list.clearSymbolsIndex();
+      expect(list.mayUseSymbol('My other layer')).toBe(true);
+      list.delete();
+    });
+
     it('can move an event to another list without invalidating it/copying it in memory', function () {
       let list1 = new gd.EventsList();
       let list2 = new gd.EventsList();
@@ -3758,6 +3804,33 @@ describe('libGD.js', function () {
       testExpression('string', '"Hello" + " " + "World"');
     });
 
+    it('can parse edited expressions', function () {
+      const parser = new gd.ExpressionParser2();
+      const previousRootNode = parser.parseExpression('ToString(12) + "Hello"');
+      // Insert "3" after "12".
+      const rootNode = parser.parseEditedExpression(
+        'ToString(123) + "Hello"',
+        previousRootNode,
+        11,
+        11,
+        12
+      );
+
+      const expressionValidator = new gd.ExpressionValidator(
+        gd.JsPlatform.get(),
+        gd.ProjectScopedContainers.makeNewProjectScopedContainersForProjectAndLayout(
+          project,
+          layout
+        ),
+        'string'
+      );
+      rootNode.get().visit(expressionValidator);
+      expect(expressionValidator.getAllErrors().size()).toBe(0);
+
+      expressionValidator.delete();
+      parser.delete();
+    });
+
     it('can parse valid expressions ("number|string" type)', function () {
       testExpression('number|string', '1+1');
       testExpression('number|string', '2-3');
@@ -199,6 +199,79 @@ describe('libGD.js - GDJS related tests', function () {
 }`
       );
     });
+    it('reuses unchanged files of the previous preview when exporting incrementally', () => {
+      const project = gd.ProjectHelper.createNewGDJSProject();
+      project.insertNewLayout('Scene 1', 0);
+      project.insertNewLayout('Scene 2', 1);
+
+      // Prepare a fake file system, remembering the files written in the
+      // export directory.
+      const fakeFiles = {
+        '/fake-gdjs-root/Runtime/index.html': fakeIndexHtmlContent,
+      };
+      const fs = makeFakeAbstractFileSystem(gd, fakeFiles);
+      fs.fileExists = function (filePath) {
+        return (
+          !filePath.startsWith('/fake-export-dir/') ||
+          fakeFiles.hasOwnProperty(filePath)
+        );
+      };
+      fs.writeToFile.mockImplementation(function (filePath, content) {
+        fakeFiles[filePath] = content;
+        return true;
+      });
+      fs.copyFile.mockImplementation(function (srcPath, destPath) {
+        fakeFiles[destPath] = fakeFiles[srcPath] || '';
+        return true;
+      });
+
+      const exportPreview = () => {
+        fs.writeToFile.mockClear();
+        fs.copyFile.mockClear();
+        const exporter = new gd.Exporter(fs, '/fake-gdjs-root');
+        const previewExportOptions = new gd.PreviewExportOptions(
+          project,
+          '/fake-export-dir'
+        );
+        previewExportOptions.setLayoutName('Scene 1');
+        previewExportOptions.setIncrementalExport(true);
+        previewExportOptions.setIncludeFileHash('runtimegame.js', 123);
+        expect(exporter.exportProjectForPixiPreview(previewExportOptions)).toBe(
+          true
+        );
+        previewExportOptions.delete();
+        exporter.delete();
+      };
+      const wasWritten = (filename) =>
+        fs.writeToFile.mock.calls.some((call) => call[0].endsWith(filename));
+      const wasCopied = (filename) =>
+        fs.copyFile.mock.calls.some((call) => call[1].endsWith(filename));
+
+      // Everything is exported the first time.
+      exportPreview();
+      expect(wasWritten('/code0.js')).toBe(true);
+      expect(wasWritten('/code1.js')).toBe(true);
+      expect(wasCopied('/runtimegame.js')).toBe(true);
+      expect(wasWritten('/incremental-export.json')).toBe(true);
+
+      // Nothing changed: only the project data is exported again.
+      exportPreview();
+      expect(wasWritten('/code0.js')).toBe(false);
+      expect(wasWritten('/code1.js')).toBe(false);
+      expect(wasCopied('/runtimegame.js')).toBe(false);
+      expect(wasWritten('/data.js')).toBe(true);
+
+      // Only the code of the modified scene is generated again.
+      project
+        .getLayout('Scene 2')
+        .getEvents()
+        .insertEvent(new gd.StandardEvent(), 0);
+      exportPreview();
+      expect(wasWritten('/code0.js')).toBe(false);
+      expect(wasWritten('/code1.js')).toBe(true);
+
+      project.delete();
+    });
   });
 
   describe('LayoutCodeGenerator', () => {
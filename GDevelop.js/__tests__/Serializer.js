@@ -140,5 +140,27 @@ describe('libGD.js object serialization', function() {
       checkJsonParseAndStringify('[{"a":1},2]');
       checkJsonParseAndStringify('{"7":[],"a":[1,2,{"b":3},{"c":[4,5]},6]}');
     });
+    it('should unserialize and reserialize JSON (values)', function() {
+      checkJsonParseAndStringify(
+        '{"a":true,"b":false,"c":-3.5,"d":"官话 😀","e":[true,"",0]}'
+      );
+    });
+    it('should convert the attributes of an element', function() {
+      const element = new gd.SerializerElement();
+      element.setBoolAttribute('a', true);
+      element.setStringAttribute('b', 'hello');
+      element.setIntAttribute('c', -3);
+      element.setDoubleAttribute('d', 2.5);
+      element.addChild('e').setStringValue('world');
+
+      expect(gd.Serializer.toJSObject(element)).toEqual({
+        a: true,
+        b: 'hello',
+        c: -3,
+        d: 2.5,
+        e: 'world',
+      });
+      element.delete();
+    });
   });
 });
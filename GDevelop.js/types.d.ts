@@ -672,6 +672,7 @@ export class ObjectJsImplementation extends ObjectConfiguration {
   updateInitialInstanceProperty(instance: InitialInstance, name: string, value: string, project: Project, scene: Layout): boolean;
   getRawJSONContent(): string;
   setRawJSONContent(newContent: string): ObjectJsImplementation;
+  getContent(): SerializerElement;
   serializeTo(element: SerializerElement): void;
   unserializeFrom(project: Project, element: SerializerElement): void;
 }
@@ -1143,6 +1144,15 @@ export class Serializer extends EmscriptenObject {
   static fromJSON(json: string): SerializerElement;
 }
 
+export class BinarySerializerBuffer extends EmscriptenObject {
+  constructor();
+  serialize(element: SerializerElement): void;
+  unserializeTo(element: SerializerElement): void;
+  resize(size: number): void;
+  getSize(): number;
+  getDataAddress(): number;
+}
+
 export class ObjectAssetSerializer extends EmscriptenObject {
   static serializeTo(project: Project, obj: gdObject, objectFullName: string, element: SerializerElement, usedResourceNames: VectorString): void;
 }
@@ -1589,6 +1599,10 @@ export class EventsList extends EmscriptenObject {
   moveEventToAnotherEventsList(eventToMove: BaseEvent, newEventsList: EventsList, newPosition: number): boolean;
   isEmpty(): boolean;
   clear(): void;
+  indexSymbols(): void;
+  clearSymbolsIndex(): void;
+  hasSymbolsIndex(): boolean;
+  mayUseSymbol(symbol: string): boolean;
   serializeTo(element: SerializerElement): void;
   unserializeFrom(project: Project, element: SerializerElement): void;
 }
@@ -1864,6 +1878,7 @@ export class VariablesChangeset extends EmscriptenObject {
 }
 
 export class WholeProjectRefactorer extends EmscriptenObject {
+  static indexEventsSymbols(project: Project): void;
   static computeChangesetForVariablesContainer(project: Project, oldSerializedVariablesContainer: SerializerElement, newVariablesContainer: VariablesContainer): VariablesChangeset;
   static applyRefactoringForVariablesContainer(project: Project, newVariablesContainer: VariablesContainer, changeset: VariablesChangeset): void;
   static renameEventsFunctionsExtension(project: Project, eventsFunctionsExtension: EventsFunctionsExtension, oldName: string, newName: string): void;
@@ -2047,6 +2062,7 @@ export class UniquePtrExpressionNode extends EmscriptenObject {
 export class ExpressionParser2 extends EmscriptenObject {
   constructor();
   parseExpression(expression: string): UniquePtrExpressionNode;
+  parseEditedExpression(expression: string, previousRootNode: UniquePtrExpressionNode, editStartPosition: number, editPreviousEndPosition: number, editEndPosition: number): UniquePtrExpressionNode;
 }
 
 export class EventsFunction extends EmscriptenObject {
@@ -2773,6 +2789,7 @@ export class PreviewExportOptions extends EmscriptenObject {
   setElectronRemoteRequirePath(electronRemoteRequirePath: string): PreviewExportOptions;
   setGDevelopResourceToken(gdevelopResourceToken: string): PreviewExportOptions;
   setAllowAuthenticationUsingIframeForPreview(enable: boolean): PreviewExportOptions;
+  setIncrementalExport(enable: boolean): PreviewExportOptions;
 }
 
 export class ExportOptions extends EmscriptenObject {
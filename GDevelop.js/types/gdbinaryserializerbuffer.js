@@ -0,0 +1,11 @@
+// Automatically generated by GDevelop.js/scripts/generate-types.js
+declare class gdBinarySerializerBuffer {
+  constructor(): void;
+  serialize(element: gdSerializerElement): void;
+  unserializeTo(element: gdSerializerElement): void;
+  resize(size: number): void;
+  getSize(): number;
+  getDataAddress(): number;
+  delete(): void;
+  ptr: number;
+};
@@ -12,6 +12,10 @@ declare class gdEventsList {
   moveEventToAnotherEventsList(eventToMove: gdBaseEvent, newEventsList: gdEventsList, newPosition: number): boolean;
   isEmpty(): boolean;
   clear(): void;
+  indexSymbols(): void;
+  clearSymbolsIndex(): void;
+  hasSymbolsIndex(): boolean;
+  mayUseSymbol(symbol: string): boolean;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(project: gdProject, element: gdSerializerElement): void;
   delete(): void;
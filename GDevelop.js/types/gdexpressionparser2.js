@@ -2,6 +2,7 @@
 declare class gdExpressionParser2 {
   constructor(): void;
   parseExpression(expression: string): gdUniquePtrExpressionNode;
+  parseEditedExpression(expression: string, previousRootNode: gdUniquePtrExpressionNode, editStartPosition: number, editPreviousEndPosition: number, editEndPosition: number): gdUniquePtrExpressionNode;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -8,6 +8,7 @@ declare class gdObjectJsImplementation extends gdObjectConfiguration {
   updateInitialInstanceProperty(instance: gdInitialInstance, name: string, value: string, project: gdProject, scene: gdLayout): boolean;
   getRawJSONContent(): string;
   setRawJSONContent(newContent: string): gdObjectJsImplementation;
+  getContent(): gdSerializerElement;
   serializeTo(element: gdSerializerElement): void;
   unserializeFrom(project: gdProject, element: gdSerializerElement): void;
   delete(): void;
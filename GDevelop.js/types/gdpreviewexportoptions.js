@@ -14,6 +14,7 @@ declare class gdPreviewExportOptions {
   setElectronRemoteRequirePath(electronRemoteRequirePath: string): gdPreviewExportOptions;
   setGDevelopResourceToken(gdevelopResourceToken: string): gdPreviewExportOptions;
   setAllowAuthenticationUsingIframeForPreview(enable: boolean): gdPreviewExportOptions;
+  setIncrementalExport(enable: boolean): gdPreviewExportOptions;
   delete(): void;
   ptr: number;
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdSerializer {
-  static fromJSObject(object: Object): gdSerializerElement;
+  static fromJSObject(object: Object, element?: gdSerializerElement): gdSerializerElement;
   static toJSObject(element: gdSerializerElement): any;
 
   static toJSON(element: gdSerializerElement): string;
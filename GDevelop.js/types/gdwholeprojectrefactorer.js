@@ -1,5 +1,6 @@
 // Automatically generated by GDevelop.js/scripts/generate-types.js
 declare class gdWholeProjectRefactorer {
+  static indexEventsSymbols(project: gdProject): void;
   static computeChangesetForVariablesContainer(project: gdProject, oldSerializedVariablesContainer: gdSerializerElement, newVariablesContainer: gdVariablesContainer): gdVariablesChangeset;
   static applyRefactoringForVariablesContainer(project: gdProject, newVariablesContainer: gdVariablesContainer, changeset: gdVariablesChangeset): void;
   static renameEventsFunctionsExtension(project: gdProject, eventsFunctionsExtension: gdEventsFunctionsExtension, oldName: string, newName: string): void;